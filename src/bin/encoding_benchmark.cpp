@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/all_type_variant.hpp"
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+// Measures how many rows per second the DictionarySegment constructor encodes for each data type.
+//
+// Usage: hyriseEncodingBenchmark [row_count] [distinct_value_count] [runs]
+
+namespace {
+
+template <typename T>
+T make_value(const uint32_t number) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return "https://example.com/item/" + std::to_string(number);
+  } else {
+    return static_cast<T>(number);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const auto row_count = argc > 1 ? std::stoul(argv[1]) : size_t{4'000'000};
+  const auto distinct_value_count = argc > 2 ? std::stoul(argv[2]) : size_t{100'000};
+  const auto run_count = argc > 3 ? std::stoul(argv[3]) : size_t{3};
+
+  std::cout << "Dictionary encoding of " << row_count << " rows with " << distinct_value_count << " distinct values ("
+            << run_count << " runs)" << std::endl;
+
+  opossum::hana::for_each(opossum::data_types, [&](auto data_type) {
+    using Type = typename decltype(+opossum::hana::second(data_type))::type;
+
+    auto generator = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<uint32_t>{0, static_cast<uint32_t>(distinct_value_count - 1)};
+
+    auto value_segment = std::make_shared<opossum::ValueSegment<Type>>();
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      value_segment->append(make_value<Type>(distribution(generator)));
+    }
+
+    auto best_duration = std::chrono::nanoseconds::max();
+    auto unique_values_count = size_t{0};
+    for (auto run = size_t{0}; run < run_count; ++run) {
+      const auto begin = std::chrono::steady_clock::now();
+      const auto dictionary_segment = opossum::DictionarySegment<Type>(value_segment);
+      best_duration = std::min(best_duration, std::chrono::steady_clock::now() - begin);
+      unique_values_count = dictionary_segment.unique_values_count();
+    }
+
+    const auto seconds = std::chrono::duration<double>(best_duration).count();
+    std::cout << std::setw(8) << opossum::hana::first(data_type) << ": " << std::setw(12) << std::fixed
+              << std::setprecision(0) << row_count / seconds << " rows/s (" << unique_values_count << " unique values, "
+              << std::setprecision(3) << seconds * 1000 << " ms)" << std::endl;
+  });
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+#include "abstract_join_operator.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/pos_list.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractJoinOperator::AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                                           const std::shared_ptr<const AbstractOperator> right,
+                                           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractOperator(left, right), _column_ids(column_ids), _scan_type(scan_type) {}
+
+const std::pair<ColumnID, ColumnID>& AbstractJoinOperator::column_ids() const { return _column_ids; }
+
+ScanType AbstractJoinOperator::scan_type() const { return _scan_type; }
+
+Chunk AbstractJoinOperator::_output_chunk(const std::shared_ptr<const PosList>& left_pos_list,
+                                          const std::shared_ptr<const PosList>& right_pos_list) const {
+  auto chunk = Chunk{};
+  _add_reference_segments(chunk, _input_table_left(), left_pos_list);
+  _add_reference_segments(chunk, _input_table_right(), right_pos_list);
+  return chunk;
+}
+
+std::shared_ptr<Table> AbstractJoinOperator::_output_table(std::vector<std::optional<Chunk>>& chunks) const {
+  auto output_table = std::make_shared<Table>();
+  for (const auto& input_table : {_input_table_left(), _input_table_right()}) {
+    for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+      output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+    }
+  }
+
+  for (auto& chunk : chunks) {
+    if (chunk) output_table->emplace_chunk(std::move(*chunk));
+  }
+
+  if (output_table->row_count() == 0) {
+    output_table->emplace_chunk(_output_chunk(std::make_shared<PosList>(), std::make_shared<PosList>()));
+  }
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "storage/chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class PosList;
+
+// AbstractJoinOperator is the super class of the join operators. They combine each row of the left input with each row
+// of the right input for which "left_value <scan_type> right_value" holds in the join columns (an inner join). The
+// output consists of the columns of the left input, followed by those of the right input, as ReferenceSegments.
+class AbstractJoinOperator : public AbstractOperator {
+ public:
+  AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                       const std::shared_ptr<const AbstractOperator> right,
+                       const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+  ScanType scan_type() const;
+
+ protected:
+  // creates an output chunk that combines the rows of the left and right input at the given positions
+  Chunk _output_chunk(const std::shared_ptr<const PosList>& left_pos_list,
+                      const std::shared_ptr<const PosList>& right_pos_list) const;
+
+  // Creates the output table with the column definitions of both inputs and the given chunks, skipping missing ones. If
+  // there are no rows, the table gets an empty chunk of ReferenceSegments.
+  std::shared_ptr<Table> _output_table(std::vector<std::optional<Chunk>>& chunks) const;
+
+  const std::pair<ColumnID, ColumnID> _column_ids;
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
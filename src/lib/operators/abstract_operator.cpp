@@ -1,10 +1,13 @@
 #include "abstract_operator.hpp"
 
 #include <chrono>
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
@@ -22,8 +25,55 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
+
 std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
 
+void AbstractOperator::_add_reference_segments(Chunk& chunk, const std::shared_ptr<const Table>& input_table,
+                                               const std::shared_ptr<const PosList>& pos_list) {
+  const auto chunk_count = input_table->chunk_count();
+
+  // resolved position lists by the position lists of the input chunks, which are nullptr for data segments
+  auto resolved_pos_lists = std::map<std::vector<const PosList*>, std::shared_ptr<const PosList>>{};
+
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    auto referenced_table = input_table;
+    auto referenced_column_id = column_id;
+    auto input_pos_lists = std::vector<const PosList*>(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& input_chunk = input_table->get_chunk(chunk_id);
+      if (input_chunk.column_count() <= column_id) continue;
+
+      const auto reference_segment =
+          std::dynamic_pointer_cast<const ReferenceSegment>(input_chunk.get_segment(column_id));
+      if (!reference_segment) continue;
+
+      DebugAssert(referenced_table == input_table || referenced_table == reference_segment->referenced_table(),
+                  "Chunks of a column have to reference the same table");
+      referenced_table = reference_segment->referenced_table();
+      referenced_column_id = reference_segment->referenced_column_id();
+      input_pos_lists[chunk_id] = reference_segment->pos_list().get();
+    }
+
+    auto& resolved_pos_list = resolved_pos_lists[input_pos_lists];
+    if (!resolved_pos_list && referenced_table == input_table) {
+      resolved_pos_list = pos_list;
+    } else if (!resolved_pos_list) {
+      auto resolved = std::make_shared<PosList>();
+      resolved->reserve(pos_list->size());
+      for (const auto row_id : *pos_list) {
+        DebugAssert(input_pos_lists[row_id.chunk_id], "Columns must not mix data and reference segments");
+        resolved->push_back((*input_pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+      }
+      resolved_pos_list = std::move(resolved);
+    }
+
+    chunk.add_segment(std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, resolved_pos_list));
+  }
+}
+
 }  // namespace opossum
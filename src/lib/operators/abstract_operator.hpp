@@ -8,6 +8,8 @@
 
 namespace opossum {
 
+class Chunk;
+class PosList;
 class Table;
 
 // AbstractOperator is the abstract super class for all operators.
@@ -54,6 +56,13 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const Table> _input_table_left() const;
   std::shared_ptr<const Table> _input_table_right() const;
 
+  // Adds a ReferenceSegment for each column of the input table to the chunk, which references the rows of the input
+  // at the given positions, e.g., for operators that combine or reorder rows. Positions of rows that are
+  // ReferenceSegments in the input are resolved, so that the output references the data tables. Columns that
+  // reference the same rows share their position lists.
+  static void _add_reference_segments(Chunk& chunk, const std::shared_ptr<const Table>& input_table,
+                                      const std::shared_ptr<const PosList>& pos_list);
+
   // Shared pointers to input operators, can be nullptr.
   std::shared_ptr<const AbstractOperator> _input_left;
   std::shared_ptr<const AbstractOperator> _input_right;
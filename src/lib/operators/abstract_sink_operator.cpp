@@ -0,0 +1,30 @@
+#include "abstract_sink_operator.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+AbstractSinkOperator::AbstractSinkOperator(const std::shared_ptr<const AbstractOperator> in) : AbstractOperator(in) {}
+
+std::shared_ptr<const Table> AbstractSinkOperator::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto sink = make_sink(input_table, input_table->chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() { sink->consume(chunk_id, chunk); }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  return sink->finish();
+}
+
+}  // namespace opossum
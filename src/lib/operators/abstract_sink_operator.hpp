@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// AbstractChunkSink consumes the chunks of the input of an AbstractSinkOperator and creates its output from them
+class AbstractChunkSink {
+ public:
+  virtual ~AbstractChunkSink() = default;
+
+  // Consumes the chunk with the given index (less than the chunk count of the sink). Chunks with different indices
+  // can be consumed concurrently.
+  virtual void consume(const size_t index, const Chunk& chunk) = 0;
+
+  // creates the output once all chunks are consumed
+  virtual std::shared_ptr<const Table> finish() = 0;
+};
+
+// AbstractSinkOperator is the super class of operators that consume their input chunk by chunk, but can only create
+// their output once all chunks are consumed, e.g., Aggregate. A Pipeline that ends with such an operator hands the
+// chunks of its last stage to the sink instead of collecting them in a table.
+class AbstractSinkOperator : public AbstractOperator {
+ public:
+  explicit AbstractSinkOperator(const std::shared_ptr<const AbstractOperator> in);
+
+  // creates a sink for up to chunk_count chunks with the columns of the given table
+  virtual std::unique_ptr<AbstractChunkSink> make_sink(const std::shared_ptr<const Table>& input_table,
+                                                       const size_t chunk_count) const = 0;
+
+ protected:
+  // consumes each chunk of the input by a job on the TaskScheduler
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "abstract_operator.hpp"
+#include "storage/chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// AbstractStreamingOperator is the super class of operators that process each chunk of their input on its own and
+// whose output has the columns of their input, e.g., TableScan. Besides being executed on their whole input, they can
+// be fused into a Pipeline, which pushes single chunks through a chain of them.
+class AbstractStreamingOperator : public AbstractOperator {
+ public:
+  explicit AbstractStreamingOperator(const std::shared_ptr<const AbstractOperator> in) : AbstractOperator(in) {}
+
+  // Processes a chunk with the columns of the input table and returns the output chunk, or std::nullopt if it has no
+  // rows. Data segments of the chunk are referenced as chunk chunk_id of the input table. Other chunks, e.g., those
+  // that a previous operator of a Pipeline returned, consist of ReferenceSegments. This can be called concurrently.
+  virtual std::optional<Chunk> process_chunk(const std::shared_ptr<const Table>& input_table, const Chunk& chunk,
+                                             const ChunkID chunk_id) const = 0;
+};
+
+}  // namespace opossum
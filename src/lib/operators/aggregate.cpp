@@ -0,0 +1,430 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Appends the value to the binary key of a group. Strings are prefixed with their length, so that keys of multiple
+// columns are unambiguous.
+template <typename T>
+void append_to_key(std::string& key, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto size = static_cast<uint32_t>(value.size());
+    key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    key.append(value);
+  } else {
+    // -0.0 and 0.0 are equal, but differ in their bits
+    const auto normalized = value == T{0} ? T{0} : value;
+    key.append(reinterpret_cast<const char*>(&normalized), sizeof(T));
+  }
+}
+
+// reads a value that append_to_key wrote at the position of the key and moves the position past it
+template <typename T>
+T read_from_key(const std::string& key, size_t& position) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto size = uint32_t{0};
+    std::memcpy(&size, key.data() + position, sizeof(size));
+    position += sizeof(size) + size;
+    return key.substr(position - size, size);
+  } else {
+    auto value = T{};
+    std::memcpy(&value, key.data() + position, sizeof(T));
+    position += sizeof(T);
+    return value;
+  }
+}
+
+// the aggregates of one column (or of the rows for COUNT(*)) for each group
+class BaseAggregateResults {
+ public:
+  virtual ~BaseAggregateResults() = default;
+
+  virtual void resize(const size_t group_count) = 0;
+
+  // aggregates each row of the segment into the group with the id at its offset in group_ids
+  virtual void aggregate(const BaseSegment& segment, const std::vector<size_t>& group_ids) = 0;
+
+  // counts the rows of each group, which does not depend on the values
+  virtual void count(const std::vector<size_t>& group_ids) = 0;
+
+  // merges the aggregates of a group of other results of the same type and function into a group of these results
+  virtual void merge(const size_t group_id, const BaseAggregateResults& other, const size_t other_group_id) = 0;
+
+  virtual std::shared_ptr<BaseSegment> output_segment() = 0;
+};
+
+template <typename T>
+class AggregateResults final : public BaseAggregateResults {
+ public:
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+  explicit AggregateResults(const AggregateFunction function) : _function(function) {}
+
+  void resize(const size_t group_count) final {
+    _counts.resize(group_count);
+    if (_function == AggregateFunction::Sum || _function == AggregateFunction::Avg) _sums.resize(group_count);
+    if (_function == AggregateFunction::Min || _function == AggregateFunction::Max) _values.resize(group_count);
+  }
+
+  void aggregate(const BaseSegment& segment, const std::vector<size_t>& group_ids) final {
+    // the function is resolved once, not for each value
+    switch (_function) {
+      case AggregateFunction::Min:
+        return _aggregate(segment, group_ids, [&](const size_t group_id, const T& value) {
+          if (_counts[group_id]++ == 0 || value < _values[group_id]) _values[group_id] = value;
+        });
+      case AggregateFunction::Max:
+        return _aggregate(segment, group_ids, [&](const size_t group_id, const T& value) {
+          if (_counts[group_id]++ == 0 || _values[group_id] < value) _values[group_id] = value;
+        });
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic_v<T>) {
+          return _aggregate(segment, group_ids, [&](const size_t group_id, const T& value) {
+            ++_counts[group_id];
+            _sums[group_id] += value;
+          });
+        }
+        Fail("Only numerical columns can be summed up");
+      case AggregateFunction::Count:
+        return count(group_ids);
+    }
+  }
+
+  void count(const std::vector<size_t>& group_ids) final {
+    for (const auto group_id : group_ids) ++_counts[group_id];
+  }
+
+  void merge(const size_t group_id, const BaseAggregateResults& other, const size_t other_group_id) final {
+    const auto& other_results = static_cast<const AggregateResults<T>&>(other);
+    const auto other_count = other_results._counts[other_group_id];
+    if (other_count == 0) return;
+
+    switch (_function) {
+      case AggregateFunction::Min:
+        if (_counts[group_id] == 0 || other_results._values[other_group_id] < _values[group_id]) {
+          _values[group_id] = other_results._values[other_group_id];
+        }
+        break;
+      case AggregateFunction::Max:
+        if (_counts[group_id] == 0 || _values[group_id] < other_results._values[other_group_id]) {
+          _values[group_id] = other_results._values[other_group_id];
+        }
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        _sums[group_id] += other_results._sums[other_group_id];
+        break;
+      case AggregateFunction::Count:
+        break;
+    }
+    _counts[group_id] += other_count;
+  }
+
+  std::shared_ptr<BaseSegment> output_segment() final {
+    switch (_function) {
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return std::make_shared<ValueSegment<T>>(std::move(_values));
+      case AggregateFunction::Sum:
+        return std::make_shared<ValueSegment<SumType>>(std::move(_sums));
+      case AggregateFunction::Avg: {
+        auto averages = std::vector<double>(_sums.size());
+        for (auto group_id = size_t{0}; group_id < averages.size(); ++group_id) {
+          averages[group_id] = static_cast<double>(_sums[group_id]) / static_cast<double>(_counts[group_id]);
+        }
+        return std::make_shared<ValueSegment<double>>(std::move(averages));
+      }
+      case AggregateFunction::Count:
+        return std::make_shared<ValueSegment<int64_t>>(std::move(_counts));
+    }
+    Fail("Unknown aggregate function");
+  }
+
+ private:
+  template <typename Update>
+  void _aggregate(const BaseSegment& segment, const std::vector<size_t>& group_ids, const Update& update) {
+    segment_for_each<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+      update(group_ids[chunk_offset], value);
+    });
+  }
+
+  const AggregateFunction _function;
+  std::vector<int64_t> _counts;
+  std::vector<SumType> _sums;
+  std::vector<T> _values;
+};
+
+// the groups of a chunk or of a partition, with the binary key, its hash, and the aggregates of each group
+struct Groups {
+  std::vector<std::string> keys;
+  std::vector<size_t> hashes;
+  std::vector<std::unique_ptr<BaseAggregateResults>> results;
+  // the group ids of a chunk, ordered by their radix partition, which begins at partition_begins[partition_id]
+  std::vector<size_t> partitioned_group_ids;
+  std::vector<size_t> partition_begins;
+};
+
+std::string function_name(const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Min:
+      return "MIN";
+    case AggregateFunction::Max:
+      return "MAX";
+    case AggregateFunction::Sum:
+      return "SUM";
+    case AggregateFunction::Avg:
+      return "AVG";
+    case AggregateFunction::Count:
+      return "COUNT";
+  }
+  Fail("Unknown aggregate function");
+}
+
+// Pre-aggregates each chunk into a hash table of its own. The groups of all chunks are merged by finish.
+class AggregateSink : public AbstractChunkSink {
+ public:
+  AggregateSink(const std::shared_ptr<const Table>& input_table, const size_t chunk_count,
+                const std::vector<AggregateColumnDefinition>& aggregates,
+                const std::vector<ColumnID>& group_by_column_ids)
+      : _input_table(input_table),
+        _aggregates(aggregates),
+        _group_by_column_ids(group_by_column_ids),
+        _chunk_groups(chunk_count),
+        _radix_partition_count(Aggregate::PARTITIONS_PER_WORKER * TaskScheduler::get().worker_count()),
+        _output_table(std::make_shared<Table>()) {
+    Assert(!_aggregates.empty() || !_group_by_column_ids.empty(), "Aggregate needs aggregates or group-by columns");
+
+    for (const auto& column_id : _group_by_column_ids) {
+      Assert(column_id < _input_table->column_count(), "Column does not exist");
+      _output_table->add_column(_input_table->column_name(column_id), _input_table->column_type(column_id));
+    }
+    for (const auto& aggregate : _aggregates) {
+      Assert(aggregate.column_id || aggregate.function == AggregateFunction::Count,
+             "Only COUNT can be used without a column");
+      if (!aggregate.column_id) {
+        _output_table->add_column("COUNT(*)", "long");
+        continue;
+      }
+
+      const auto column_id = *aggregate.column_id;
+      Assert(column_id < _input_table->column_count(), "Column does not exist");
+      const auto& type = _input_table->column_type(column_id);
+      const auto name = function_name(aggregate.function) + "(" + _input_table->column_name(column_id) + ")";
+      switch (aggregate.function) {
+        case AggregateFunction::Min:
+        case AggregateFunction::Max:
+          _output_table->add_column(name, type);
+          break;
+        case AggregateFunction::Sum:
+          Assert(type != "string", "Only numerical columns can be summed up");
+          _output_table->add_column(name, type == "int" || type == "long" ? "long" : "double");
+          break;
+        case AggregateFunction::Avg:
+          Assert(type != "string", "Only numerical columns can be averaged");
+          _output_table->add_column(name, "double");
+          break;
+        case AggregateFunction::Count:
+          _output_table->add_column(name, "long");
+          break;
+      }
+    }
+  }
+
+  void consume(const size_t index, const Chunk& chunk) final {
+    auto& groups = _chunk_groups[index];
+    auto group_ids = std::vector<size_t>(chunk.size());
+    auto is_dense = false;
+
+    if (_group_by_column_ids.empty()) {
+      groups.keys.emplace_back();
+    } else if (_group_by_column_ids.size() == 1) {
+      // group by the ValueIDs of a DictionarySegment, which cover all of its values
+      const auto& segment = *chunk.get_segment(_group_by_column_ids.front());
+      resolve_data_type(_input_table->column_type(_group_by_column_ids.front()), [&](auto data_type) {
+        using Type = typename decltype(data_type)::type;
+        const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment);
+        if (!dictionary_segment) return;
+
+        is_dense = true;
+        resolve_attribute_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < group_ids.size(); ++chunk_offset) {
+            group_ids[chunk_offset] = attribute_vector.get(chunk_offset);
+          }
+        });
+        groups.keys.resize(dictionary_segment->unique_values_count());
+        for (auto value_id = ValueID{0}; value_id < groups.keys.size(); ++value_id) {
+          append_to_key(groups.keys[value_id], dictionary_segment->value_by_value_id(value_id));
+        }
+      });
+    }
+
+    if (!is_dense && !_group_by_column_ids.empty()) {
+      auto keys = std::vector<std::string>(chunk.size());
+      for (const auto& column_id : _group_by_column_ids) {
+        resolve_data_type(_input_table->column_type(column_id), [&](auto data_type) {
+          using Type = typename decltype(data_type)::type;
+          segment_for_each<Type>(*chunk.get_segment(column_id), [&](const Type& value, const ChunkOffset chunk_offset) {
+            append_to_key(keys[chunk_offset], value);
+          });
+        });
+      }
+
+      auto group_ids_by_key = std::unordered_map<std::string, size_t>{};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+        const auto [group, inserted] = group_ids_by_key.try_emplace(std::move(keys[chunk_offset]), groups.keys.size());
+        if (inserted) groups.keys.push_back(group->first);
+        group_ids[chunk_offset] = group->second;
+      }
+    }
+
+    groups.hashes.reserve(groups.keys.size());
+    for (const auto& key : groups.keys) groups.hashes.push_back(std::hash<std::string>{}(key));
+
+    // scatter the group ids by their radix partition, so that each merge job of finish only reads its own groups
+    groups.partition_begins.resize(_radix_partition_count + 1);
+    for (const auto hash : groups.hashes) ++groups.partition_begins[hash % _radix_partition_count + 1];
+    for (auto partition_id = size_t{0}; partition_id < _radix_partition_count; ++partition_id) {
+      groups.partition_begins[partition_id + 1] += groups.partition_begins[partition_id];
+    }
+    auto partition_ends = std::vector<size_t>(groups.partition_begins.cbegin(), groups.partition_begins.cend() - 1);
+    groups.partitioned_group_ids.resize(groups.keys.size());
+    for (auto group_id = size_t{0}; group_id < groups.keys.size(); ++group_id) {
+      groups.partitioned_group_ids[partition_ends[groups.hashes[group_id] % _radix_partition_count]++] = group_id;
+    }
+
+    groups.results = _make_results();
+    for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+      auto& results = *groups.results[aggregate_id];
+      results.resize(groups.keys.size());
+      const auto& column_id = _aggregates[aggregate_id].column_id;
+      if (column_id) {
+        results.aggregate(*chunk.get_segment(*column_id), group_ids);
+      } else {
+        results.count(group_ids);
+      }
+    }
+  }
+
+  std::shared_ptr<const Table> finish() final {
+    // Merge the groups of all chunks by partition, so no locks are needed. Each partition covers a contiguous range of
+    // the radix partitions of consume, so that small results are not split into many partitions.
+    auto group_count = size_t{0};
+    for (const auto& groups : _chunk_groups) group_count += groups.keys.size();
+    const auto partition_count =
+        std::max(size_t{1}, std::min(_radix_partition_count, group_count / Aggregate::MIN_PARTITION_GROUPS));
+
+    auto output_chunks = std::vector<std::optional<Chunk>>(partition_count);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+        auto merged = Groups{};
+        merged.results = _make_results();
+        auto group_ids_by_key = std::unordered_map<std::string, size_t>{};
+        const auto radix_partition_begin = partition_id * _radix_partition_count / partition_count;
+        const auto radix_partition_end = (partition_id + 1) * _radix_partition_count / partition_count;
+        for (const auto& groups : _chunk_groups) {
+          // skip the chunks that were not consumed, e.g., because a Pipeline filtered out all of their rows
+          if (groups.partition_begins.empty()) continue;
+
+          const auto begin = groups.partition_begins[radix_partition_begin];
+          const auto end = groups.partition_begins[radix_partition_end];
+          for (auto index = begin; index < end; ++index) {
+            const auto group_id = groups.partitioned_group_ids[index];
+            const auto [group, inserted] = group_ids_by_key.try_emplace(groups.keys[group_id], merged.keys.size());
+            if (inserted) {
+              merged.keys.push_back(groups.keys[group_id]);
+              for (auto& results : merged.results) results->resize(merged.keys.size());
+            }
+            for (auto aggregate_id = size_t{0}; aggregate_id < _aggregates.size(); ++aggregate_id) {
+              merged.results[aggregate_id]->merge(group->second, *groups.results[aggregate_id], group_id);
+            }
+          }
+        }
+        if (merged.keys.empty()) return;
+
+        // decode the group-by values from the keys
+        auto& chunk = output_chunks[partition_id].emplace();
+        auto key_positions = std::vector<size_t>(merged.keys.size());
+        for (const auto& column_id : _group_by_column_ids) {
+          resolve_data_type(_input_table->column_type(column_id), [&](auto data_type) {
+            using Type = typename decltype(data_type)::type;
+            auto values = std::vector<Type>{};
+            values.reserve(merged.keys.size());
+            for (auto group_id = size_t{0}; group_id < merged.keys.size(); ++group_id) {
+              values.push_back(read_from_key<Type>(merged.keys[group_id], key_positions[group_id]));
+            }
+            chunk.add_segment(std::make_shared<ValueSegment<Type>>(std::move(values)));
+          });
+        }
+        for (auto& results : merged.results) chunk.add_segment(results->output_segment());
+      }));
+    }
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+    for (auto& output_chunk : output_chunks) {
+      if (output_chunk) _output_table->emplace_chunk(std::move(*output_chunk));
+    }
+    return _output_table;
+  }
+
+ private:
+  std::vector<std::unique_ptr<BaseAggregateResults>> _make_results() const {
+    auto results = std::vector<std::unique_ptr<BaseAggregateResults>>{};
+    for (const auto& aggregate : _aggregates) {
+      if (aggregate.function == AggregateFunction::Count) {
+        results.emplace_back(std::make_unique<AggregateResults<int64_t>>(AggregateFunction::Count));
+      } else {
+        results.emplace_back(make_unique_by_data_type<BaseAggregateResults, AggregateResults>(
+            _input_table->column_type(*aggregate.column_id), aggregate.function));
+      }
+    }
+    return results;
+  }
+
+  const std::shared_ptr<const Table> _input_table;
+  const std::vector<AggregateColumnDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+  std::vector<Groups> _chunk_groups;
+  const size_t _radix_partition_count;
+  const std::shared_ptr<Table> _output_table;
+};
+
+}  // namespace
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator> in,
+                     const std::vector<AggregateColumnDefinition>& aggregates,
+                     const std::vector<ColumnID>& group_by_column_ids)
+    : AbstractSinkOperator(in), _aggregates(aggregates), _group_by_column_ids(group_by_column_ids) {}
+
+const std::vector<AggregateColumnDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+std::unique_ptr<AbstractChunkSink> Aggregate::make_sink(const std::shared_ptr<const Table>& input_table,
+                                                        const size_t chunk_count) const {
+  return std::make_unique<AggregateSink>(input_table, chunk_count, _aggregates, _group_by_column_ids);
+}
+
+}  // namespace opossum
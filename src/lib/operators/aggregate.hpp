@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_sink_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class AggregateFunction { Min, Max, Sum, Avg, Count };
+
+struct AggregateColumnDefinition {
+  // the aggregated column, std::nullopt for COUNT(*)
+  std::optional<ColumnID> column_id;
+  AggregateFunction function;
+};
+
+// Groups the rows of the input by the values of the group-by columns and computes the aggregates of each group. The
+// output consists of the group-by columns, followed by one column per aggregate (e.g., "SUM(a)"), as ValueSegments.
+// COUNT returns a long, SUM a long for integral and a double for floating-point columns, AVG a double, and MIN and MAX
+// the type of their column. Without group-by columns, all rows form a single group, unless the input is empty.
+//
+// Each chunk is pre-aggregated by a job on the TaskScheduler (or of a Pipeline) into a hash table of its own. If the
+// only group-by column of a chunk is a DictionarySegment, the ValueIDs serve as dense group ids instead, so no value is
+// hashed. Each chunk then scatters its groups into radix partitions by their hash, and each partition is merged by a
+// job that reads only the groups of its partition, so no locks are needed. Each non-empty partition becomes an output
+// chunk, so the order of the groups is not defined.
+class Aggregate : public AbstractSinkOperator {
+ public:
+  // The groups are merged in up to PARTITIONS_PER_WORKER partitions per worker, with at least MIN_PARTITION_GROUPS
+  // groups of the chunks per partition on average.
+  static constexpr auto PARTITIONS_PER_WORKER = size_t{4};
+  static constexpr auto MIN_PARTITION_GROUPS = size_t{1'024};
+
+  Aggregate(const std::shared_ptr<const AbstractOperator> in, const std::vector<AggregateColumnDefinition>& aggregates,
+            const std::vector<ColumnID>& group_by_column_ids);
+
+  const std::vector<AggregateColumnDefinition>& aggregates() const;
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+  std::unique_ptr<AbstractChunkSink> make_sink(const std::shared_ptr<const Table>& input_table,
+                                               const size_t chunk_count) const override;
+
+ protected:
+  const std::vector<AggregateColumnDefinition> _aggregates;
+  const std::vector<ColumnID> _group_by_column_ids;
+};
+
+}  // namespace opossum
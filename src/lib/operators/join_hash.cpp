@@ -0,0 +1,233 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+uint64_t hash_value(const T& value) {
+  auto hash = uint64_t{0};
+  if constexpr (std::is_same_v<T, std::string>) {
+    hash = std::hash<std::string>{}(value);
+  } else if constexpr (std::is_floating_point_v<T>) {
+    // -0.0 and 0.0 are equal, but differ in their bits
+    const auto normalized = value == T{0} ? T{0} : value;
+    std::memcpy(&hash, &normalized, sizeof(T));
+  } else {
+    hash = static_cast<uint64_t>(value);
+  }
+
+  // The finalizer of MurmurHash3 spreads the bits, as both the partition and the slot are taken from the lower bits
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+template <typename T>
+struct HashedValue {
+  uint64_t hash;
+  T value;
+  RowID row_id;
+};
+
+// the values of an input, grouped by partition, with partition i in [partition_begins[i], partition_begins[i + 1])
+template <typename T>
+struct PartitionedValues {
+  std::vector<HashedValue<T>> values;
+  std::vector<size_t> partition_begins;
+};
+
+template <typename T>
+PartitionedValues<T> radix_partition(const Table& table, const ColumnID column_id, const size_t radix_bits) {
+  const auto chunk_count = table.chunk_count();
+  const auto partition_count = size_t{1} << radix_bits;
+  const auto partition_mask = partition_count - 1;
+
+  // materialize the values of each chunk and count how many of them fall into each partition
+  auto chunk_values = std::vector<std::vector<HashedValue<T>>>(chunk_count);
+  auto histograms = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& values = chunk_values[chunk_id];
+      auto& histogram = histograms[chunk_id];
+      values.reserve(chunk.size());
+      segment_for_each<T>(*chunk.get_segment(column_id), [&](const T& value, const ChunkOffset chunk_offset) {
+        const auto hash = hash_value(value);
+        values.push_back(HashedValue<T>{hash, value, RowID{chunk_id, chunk_offset}});
+        ++histogram[hash & partition_mask];
+      });
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  // Turn the histograms into the offsets at which each chunk writes into each partition. Within a partition, the
+  // values keep the order of the chunks.
+  auto partitioned = PartitionedValues<T>{};
+  partitioned.partition_begins.resize(partition_count + 1);
+  auto offset = size_t{0};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    partitioned.partition_begins[partition_id] = offset;
+    for (auto& histogram : histograms) {
+      const auto count = histogram[partition_id];
+      histogram[partition_id] = offset;
+      offset += count;
+    }
+  }
+  partitioned.partition_begins[partition_count] = offset;
+
+  partitioned.values.resize(offset);
+  jobs.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (chunk_values[chunk_id].empty()) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& write_offsets = histograms[chunk_id];
+      for (auto& value : chunk_values[chunk_id]) {
+        partitioned.values[write_offsets[value.hash & partition_mask]++] = std::move(value);
+      }
+      chunk_values[chunk_id] = {};
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  return partitioned;
+}
+
+// Calls emit(build_row_id, probe_row_id) for each pair of equal values. All values have the same lower radix_bits
+// bits of their hash, so the slots are taken from the bits above them.
+template <typename T, typename Emit>
+void join_partition(const HashedValue<T>* build_values, const size_t build_size, const HashedValue<T>* probe_values,
+                    const size_t probe_size, const size_t radix_bits, const Emit& emit) {
+  if (build_size == 0 || probe_size == 0) return;
+
+  Assert(build_size < std::numeric_limits<uint32_t>::max(), "Partition is too large");
+  auto capacity = size_t{1};
+  while (capacity < 2 * build_size) capacity <<= 1;
+  const auto slot_mask = capacity - 1;
+  const auto slot_of = [&](const uint64_t hash) { return (hash >> radix_bits) & slot_mask; };
+
+  // slots hold the index of a build value plus one, zero marks an empty slot
+  auto slots = std::vector<uint32_t>(capacity);
+  for (auto index = size_t{0}; index < build_size; ++index) {
+    auto slot = slot_of(build_values[index].hash);
+    while (slots[slot] != 0) slot = (slot + 1) & slot_mask;
+    slots[slot] = static_cast<uint32_t>(index + 1);
+  }
+
+  for (auto index = size_t{0}; index < probe_size; ++index) {
+    if (index + JoinHash::PREFETCH_DISTANCE < probe_size) {
+      __builtin_prefetch(&slots[slot_of(probe_values[index + JoinHash::PREFETCH_DISTANCE].hash)]);
+    }
+
+    const auto& probe_value = probe_values[index];
+    for (auto slot = slot_of(probe_value.hash); slots[slot] != 0; slot = (slot + 1) & slot_mask) {
+      const auto& build_value = build_values[slots[slot] - 1];
+      if (build_value.hash == probe_value.hash && build_value.value == probe_value.value) {
+        emit(build_value.row_id, probe_value.row_id);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right,
+                   const std::pair<ColumnID, ColumnID>& column_ids)
+    : AbstractJoinOperator(left, right, column_ids, ScanType::OpEquals) {}
+
+size_t JoinHash::radix_bits(const size_t build_row_count, const size_t value_size) {
+  const auto build_size = build_row_count * value_size;
+  auto radix_bits = size_t{0};
+  while (radix_bits < MAX_RADIX_BITS &&
+         ((size_t{1} << radix_bits) < TaskScheduler::get().worker_count() ||
+          build_size >> radix_bits > CACHE_SIZE)) {
+    ++radix_bits;
+  }
+  return radix_bits;
+}
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  const auto& type = left_table->column_type(_column_ids.first);
+  Assert(type == right_table->column_type(_column_ids.second), "Join columns have to have the same type");
+
+  // the smaller input is the build side
+  const auto build_left = left_table->row_count() <= right_table->row_count();
+  const auto& build_table = build_left ? *left_table : *right_table;
+  const auto& probe_table = build_left ? *right_table : *left_table;
+  const auto build_column_id = build_left ? _column_ids.first : _column_ids.second;
+  const auto probe_column_id = build_left ? _column_ids.second : _column_ids.first;
+
+  auto output_chunks = std::vector<std::optional<Chunk>>{};
+  resolve_data_type(type, [&](auto data_type) {
+    using Type = typename decltype(data_type)::type;
+
+    const auto radix_bits = JoinHash::radix_bits(build_table.row_count(), sizeof(HashedValue<Type>));
+    auto build_partitions = PartitionedValues<Type>{};
+    auto probe_partitions = PartitionedValues<Type>{};
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      build_partitions = radix_partition<Type>(build_table, build_column_id, radix_bits);
+    }));
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      probe_partitions = radix_partition<Type>(probe_table, probe_column_id, radix_bits);
+    }));
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+    const auto partition_count = size_t{1} << radix_bits;
+    output_chunks.resize(partition_count);
+    jobs.clear();
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+        const auto build_begin = build_partitions.partition_begins[partition_id];
+        const auto probe_begin = probe_partitions.partition_begins[partition_id];
+        auto left_pos_list = std::make_shared<PosList>();
+        auto right_pos_list = std::make_shared<PosList>();
+        join_partition<Type>(build_partitions.values.data() + build_begin,
+                             build_partitions.partition_begins[partition_id + 1] - build_begin,
+                             probe_partitions.values.data() + probe_begin,
+                             probe_partitions.partition_begins[partition_id + 1] - probe_begin, radix_bits,
+                             [&](const RowID& build_row_id, const RowID& probe_row_id) {
+                               left_pos_list->push_back(build_left ? build_row_id : probe_row_id);
+                               right_pos_list->push_back(build_left ? probe_row_id : build_row_id);
+                             });
+        if (left_pos_list->empty()) return;
+
+        output_chunks[partition_id] = _output_chunk(left_pos_list, right_pos_list);
+      }));
+    }
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+  });
+
+  return _output_table(output_chunks);
+}
+
+}  // namespace opossum
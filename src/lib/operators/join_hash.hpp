@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// JoinHash is an equi-join of two inputs whose join columns have the same data type.
+//
+// Both inputs are radix partitioned by the hash of their join values, so that the values of the smaller (build) input
+// in a partition fit into CACHE_SIZE. The values and RowIDs of each chunk are materialized and scattered into the
+// partitions as jobs on the TaskScheduler. The partitions are then joined as jobs: the build side is inserted into an
+// open-addressing hash table with linear probing, and the probe side looks up its values in it, prefetching the slot
+// of the value PREFETCH_DISTANCE positions ahead. Each non-empty partition becomes an output chunk, so the order of the
+// output rows is not defined.
+class JoinHash : public AbstractJoinOperator {
+ public:
+  // the size of a build partition that should fit into the (L2) cache
+  static constexpr auto CACHE_SIZE = size_t{256 * 1024};
+
+  // limits the number of partitions that are written to at once, which would thrash the TLB otherwise
+  static constexpr auto MAX_RADIX_BITS = size_t{10};
+
+  static constexpr auto PREFETCH_DISTANCE = size_t{16};
+
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const std::pair<ColumnID, ColumnID>& column_ids);
+
+  // Returns the number of bits of the hash that select the partition for a build side of the given size, i.e., there
+  // are 2^radix_bits partitions. There are at least as many partitions as workers.
+  static size_t radix_bits(const size_t build_row_count, const size_t value_size);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
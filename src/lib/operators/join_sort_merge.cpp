@@ -0,0 +1,308 @@
+#include "join_sort_merge.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/radix_sort.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+using ValueRowIDs = std::vector<std::pair<T, RowID>>;
+
+template <typename T>
+bool value_less(const std::pair<T, RowID>& lhs, const std::pair<T, RowID>& rhs) {
+  return lhs.first < rhs.first;
+}
+
+// the join values of an input by chunk, and whether they are sorted across all chunks
+template <typename T>
+struct MaterializedInput {
+  std::vector<ValueRowIDs<T>> chunks;
+  bool is_sorted;
+};
+
+template <typename T>
+MaterializedInput<T> materialize_input(const Table& table, const ColumnID column_id) {
+  const auto chunk_count = table.chunk_count();
+  auto input = MaterializedInput<T>{std::vector<ValueRowIDs<T>>(chunk_count), true};
+  auto chunks_sorted = std::vector<char>(chunk_count, true);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& values = input.chunks[chunk_id];
+      values.reserve(chunk.size());
+      segment_for_each<T>(*chunk.get_segment(column_id), [&](const T& value, const ChunkOffset chunk_offset) {
+        values.emplace_back(value, RowID{chunk_id, chunk_offset});
+      });
+      chunks_sorted[chunk_id] = std::is_sorted(values.cbegin(), values.cend(), value_less<T>);
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  const auto* previous_chunk = static_cast<const ValueRowIDs<T>*>(nullptr);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& values = input.chunks[chunk_id];
+    if (values.empty()) continue;
+
+    input.is_sorted &= chunks_sorted[chunk_id] &&
+                       (!previous_chunk || !(values.front().first < previous_chunk->back().first));
+    previous_chunk = &values;
+  }
+  return input;
+}
+
+// returns the partition_count - 1 (or fewer, if there are few distinct values) bounds of the value ranges
+template <typename T>
+std::vector<T> choose_splitters(const MaterializedInput<T>& left, const MaterializedInput<T>& right,
+                                const size_t row_count, const size_t partition_count) {
+  if (partition_count == 1) return {};
+
+  const auto stride = std::max(size_t{1}, row_count / (partition_count * JoinSortMerge::SAMPLES_PER_PARTITION));
+  auto samples = std::vector<T>{};
+  for (const auto& input : {&left, &right}) {
+    for (const auto& values : input->chunks) {
+      for (auto index = size_t{0}; index < values.size(); index += stride) samples.push_back(values[index].first);
+    }
+  }
+  std::sort(samples.begin(), samples.end());
+
+  auto splitters = std::vector<T>{};
+  for (auto partition_id = size_t{1}; partition_id < partition_count; ++partition_id) {
+    const auto& splitter = samples[partition_id * samples.size() / partition_count];
+    if (splitters.empty() || splitters.back() < splitter) splitters.push_back(splitter);
+  }
+  return splitters;
+}
+
+// Splits the values into sorted partitions, where partition i holds the values in [splitters[i - 1], splitters[i]).
+template <typename T>
+std::vector<ValueRowIDs<T>> range_partition(MaterializedInput<T>& input, const std::vector<T>& splitters) {
+  const auto partition_count = splitters.size() + 1;
+  auto partitions = std::vector<ValueRowIDs<T>>(partition_count);
+
+  if (input.is_sorted) {
+    // the partitions are slices of the values, which are already sorted
+    auto partition_id = size_t{0};
+    for (auto& values : input.chunks) {
+      for (auto& value : values) {
+        while (partition_id < splitters.size() && !(value.first < splitters[partition_id])) ++partition_id;
+        partitions[partition_id].push_back(std::move(value));
+      }
+      values = {};
+    }
+    return partitions;
+  }
+
+  const auto partition_of = [&](const T& value) {
+    return static_cast<size_t>(std::upper_bound(splitters.cbegin(), splitters.cend(), value) - splitters.cbegin());
+  };
+
+  // count the values of each chunk per partition and turn the counts into write offsets
+  const auto chunk_count = input.chunks.size();
+  auto histograms = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = size_t{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (input.chunks[chunk_id].empty()) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      for (const auto& value : input.chunks[chunk_id]) ++histograms[chunk_id][partition_of(value.first)];
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    auto offset = size_t{0};
+    for (auto& histogram : histograms) {
+      const auto count = histogram[partition_id];
+      histogram[partition_id] = offset;
+      offset += count;
+    }
+    partitions[partition_id].resize(offset);
+  }
+
+  jobs.clear();
+  for (auto chunk_id = size_t{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (input.chunks[chunk_id].empty()) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& write_offsets = histograms[chunk_id];
+      for (auto& value : input.chunks[chunk_id]) {
+        const auto partition_id = partition_of(value.first);
+        partitions[partition_id][write_offsets[partition_id]++] = std::move(value);
+      }
+      input.chunks[chunk_id] = {};
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  jobs.clear();
+  for (auto& partition : partitions) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      if constexpr (std::is_integral_v<T>) {
+        radix_sort(partition);
+      } else {
+        std::sort(partition.begin(), partition.end(), value_less<T>);
+      }
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  return partitions;
+}
+
+// returns whether "left <scan_type> right" holds for all values of a left range and all values of a lower (or, if
+// not lower, higher) right range
+bool all_match(const ScanType scan_type, const bool right_is_lower) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return false;
+    case ScanType::OpNotEquals:
+      return true;
+    case ScanType::OpLessThan:
+    case ScanType::OpLessThanEquals:
+      return !right_is_lower;
+    case ScanType::OpGreaterThan:
+    case ScanType::OpGreaterThanEquals:
+      return right_is_lower;
+  }
+  Fail("Unknown scan type");
+}
+
+// Calls emit(left_index, right_begin, right_end) for each value of the sorted left values with the ranges of the
+// sorted right values that it matches. The bounds of the equal right values move forward with the left values.
+template <typename T, typename Emit>
+void merge_partition(const ValueRowIDs<T>& left, const ValueRowIDs<T>& right, const ScanType scan_type,
+                     const Emit& emit) {
+  auto equal_begin = size_t{0};
+  auto equal_end = size_t{0};
+  for (auto left_index = size_t{0}; left_index < left.size(); ++left_index) {
+    const auto& value = left[left_index].first;
+    while (equal_begin < right.size() && right[equal_begin].first < value) ++equal_begin;
+    equal_end = std::max(equal_begin, equal_end);
+    while (equal_end < right.size() && !(value < right[equal_end].first)) ++equal_end;
+
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        emit(left_index, equal_begin, equal_end);
+        break;
+      case ScanType::OpNotEquals:
+        emit(left_index, size_t{0}, equal_begin);
+        emit(left_index, equal_end, right.size());
+        break;
+      case ScanType::OpLessThan:
+        emit(left_index, equal_end, right.size());
+        break;
+      case ScanType::OpLessThanEquals:
+        emit(left_index, equal_begin, right.size());
+        break;
+      case ScanType::OpGreaterThan:
+        emit(left_index, size_t{0}, equal_begin);
+        break;
+      case ScanType::OpGreaterThanEquals:
+        emit(left_index, size_t{0}, equal_end);
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
+                             const std::shared_ptr<const AbstractOperator> right,
+                             const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator(left, right, column_ids, scan_type) {}
+
+std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  const auto& type = left_table->column_type(_column_ids.first);
+  Assert(type == right_table->column_type(_column_ids.second), "Join columns have to have the same type");
+
+  auto output_chunks = std::vector<std::optional<Chunk>>{};
+  resolve_data_type(type, [&](auto data_type) {
+    using Type = typename decltype(data_type)::type;
+
+    auto left_input = MaterializedInput<Type>{};
+    auto right_input = MaterializedInput<Type>{};
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      left_input = materialize_input<Type>(*left_table, _column_ids.first);
+    }));
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      right_input = materialize_input<Type>(*right_table, _column_ids.second);
+    }));
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+    const auto row_count = left_table->row_count() + right_table->row_count();
+    const auto max_partition_count = PARTITIONS_PER_WORKER * TaskScheduler::get().worker_count();
+    const auto partition_count =
+        std::max(size_t{1}, std::min(max_partition_count, static_cast<size_t>(row_count / MIN_PARTITION_SIZE)));
+    const auto splitters = choose_splitters(left_input, right_input, row_count, partition_count);
+
+    auto left_partitions = std::vector<ValueRowIDs<Type>>{};
+    auto right_partitions = std::vector<ValueRowIDs<Type>>{};
+    jobs.clear();
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      left_partitions = range_partition(left_input, splitters);
+    }));
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      right_partitions = range_partition(right_input, splitters);
+    }));
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+    output_chunks.resize(left_partitions.size());
+    jobs.clear();
+    for (auto partition_id = size_t{0}; partition_id < left_partitions.size(); ++partition_id) {
+      if (left_partitions[partition_id].empty()) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+        const auto& left = left_partitions[partition_id];
+        auto left_pos_list = std::make_shared<PosList>();
+        auto right_pos_list = std::make_shared<PosList>();
+
+        for (auto right_partition_id = size_t{0}; right_partition_id < right_partitions.size(); ++right_partition_id) {
+          const auto& right = right_partitions[right_partition_id];
+          const auto emit = [&](const size_t left_index, const size_t right_begin, const size_t right_end) {
+            for (auto right_index = right_begin; right_index < right_end; ++right_index) {
+              left_pos_list->push_back(left[left_index].second);
+              right_pos_list->push_back(right[right_index].second);
+            }
+          };
+
+          if (right_partition_id == partition_id) {
+            merge_partition(left, right, _scan_type, emit);
+          } else if (all_match(_scan_type, right_partition_id < partition_id)) {
+            for (auto left_index = size_t{0}; left_index < left.size(); ++left_index) emit(left_index, 0, right.size());
+          }
+        }
+        if (left_pos_list->empty()) return;
+
+        output_chunks[partition_id] = _output_chunk(left_pos_list, right_pos_list);
+      }));
+    }
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+  });
+
+  return _output_table(output_chunks);
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// JoinSortMerge joins two inputs whose join columns have the same data type with any of the scan types, e.g., for
+// "left.a < right.b". Only the join values and their RowIDs are materialized.
+//
+// Both inputs are split into the same value ranges, whose bounds are taken from a sample of both inputs. The ranges
+// are sorted as jobs on the TaskScheduler. Inputs whose chunks are already sorted in order (e.g., after a Sort) are
+// sliced into the ranges without sorting. Each range of the left input is then joined as a job: Within the same range
+// of the right input, the matches are found by merging the sorted values. All values in lower or higher ranges of the
+// right input either match or do not match as a whole. Each non-empty range of the left input becomes an output chunk.
+class JoinSortMerge : public AbstractJoinOperator {
+ public:
+  // Inputs are split into ranges of at least this many values on average. There are up to PARTITIONS_PER_WORKER ranges
+  // per worker, so that idle workers can take over ranges of skewed inputs.
+  static constexpr auto MIN_PARTITION_SIZE = size_t{10'000};
+  static constexpr auto PARTITIONS_PER_WORKER = size_t{4};
+
+  // number of values that are sampled per range to find the range bounds
+  static constexpr auto SAMPLES_PER_PARTITION = size_t{64};
+
+  JoinSortMerge(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+                const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
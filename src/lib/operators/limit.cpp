@@ -0,0 +1,98 @@
+#include "limit.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns a list of the first count positions of the given one
+std::shared_ptr<const PosList> pos_list_prefix(const PosList& pos_list, const size_t count, const Table& table) {
+  if (pos_list.is_materialized()) {
+    const auto& row_ids = pos_list.row_ids();
+    return std::make_shared<PosList>(std::vector<RowID>(row_ids.cbegin(), row_ids.cbegin() + count));
+  }
+
+  const auto chunk_id = pos_list.single_chunk_id();
+  auto offsets = std::vector<ChunkOffset>(count);
+  for (auto index = size_t{0}; index < count; ++index) offsets[index] = pos_list[index].chunk_offset;
+  return PosList::chunk_selection(
+      chunk_id, std::make_shared<const ChunkSelection>(table.get_chunk(chunk_id).size(), std::move(offsets)));
+}
+
+}  // namespace
+
+Limit::Limit(const std::shared_ptr<const AbstractOperator> in, const size_t row_count)
+    : AbstractOperator(in), _row_count(row_count) {}
+
+size_t Limit::row_count() const { return _row_count; }
+
+std::shared_ptr<const Table> Limit::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  auto remaining_row_count = _row_count;
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count() && remaining_row_count > 0; ++chunk_id) {
+    const auto& input_chunk = input_table->get_chunk(chunk_id);
+    const auto count = std::min(remaining_row_count, size_t{input_chunk.size()});
+    if (count == 0) continue;
+    remaining_row_count -= count;
+
+    auto output_chunk = Chunk{};
+    auto data_pos_list = std::shared_ptr<const PosList>{};
+    auto prefix_pos_lists = std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>>{};
+    for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+      const auto segment = input_chunk.get_segment(column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+
+      if (!reference_segment) {
+        if (!data_pos_list && count == input_chunk.size()) {
+          data_pos_list = PosList::entire_chunk(chunk_id, input_chunk.size());
+        } else if (!data_pos_list) {
+          auto offsets = std::vector<ChunkOffset>(count);
+          std::iota(offsets.begin(), offsets.end(), ChunkOffset{0});
+          data_pos_list = PosList::chunk_selection(
+              chunk_id, std::make_shared<const ChunkSelection>(input_chunk.size(), std::move(offsets)));
+        }
+        output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, data_pos_list));
+        continue;
+      }
+
+      if (count == input_chunk.size()) {
+        output_chunk.add_segment(segment);
+        continue;
+      }
+
+      const auto& input_pos_list = reference_segment->pos_list();
+      auto& prefix_pos_list = prefix_pos_lists[input_pos_list];
+      if (!prefix_pos_list) {
+        prefix_pos_list = pos_list_prefix(*input_pos_list, count, *reference_segment->referenced_table());
+      }
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(reference_segment->referenced_table(),
+                                                                  reference_segment->referenced_column_id(),
+                                                                  prefix_pos_list));
+    }
+    output_table->emplace_chunk(std::move(output_chunk));
+  }
+
+  if (output_table->row_count() == 0) {
+    auto output_chunk = Chunk{};
+    _add_reference_segments(output_chunk, input_table, std::make_shared<PosList>());
+    output_table->emplace_chunk(std::move(output_chunk));
+  }
+  return output_table;
+}
+
+}  // namespace opossum
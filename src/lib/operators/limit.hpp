@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Returns the first row_count rows of the input as ReferenceSegments. The chunks of the input are visited in order
+// and Limit stops as soon as it has enough rows, so later chunks are never touched. Chunks that are part of the output
+// as a whole reuse the position lists of the input.
+class Limit : public AbstractOperator {
+ public:
+  Limit(const std::shared_ptr<const AbstractOperator> in, const size_t row_count);
+
+  size_t row_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const size_t _row_count;
+};
+
+}  // namespace opossum
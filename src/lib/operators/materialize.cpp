@@ -0,0 +1,155 @@
+#include "materialize.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Calls store(index, value) with the value at offset_at(index) of a data segment for each index in [0, count). The
+// value that is accessed PREFETCH_DISTANCE indices later is prefetched.
+template <typename T, typename OffsetAt, typename Store>
+void gather(const BaseSegment& segment, const size_t count, const OffsetAt& offset_at, const Store& store) {
+  detail::with_point_accessor<T>(segment, count, [&](const auto& accessor) {
+    detail::with_prefetcher<T>(segment, [&](const auto& prefetch) {
+      for (auto index = size_t{0}; index < count; ++index) {
+        if (index + Materialize::PREFETCH_DISTANCE < count) prefetch(offset_at(index + Materialize::PREFETCH_DISTANCE));
+        store(index, accessor(offset_at(index)));
+      }
+    });
+  });
+}
+
+// gathers the referenced values of a ReferenceSegment whose positions are not sorted
+template <typename T>
+std::vector<T> gather_unsorted(const ReferenceSegment& segment) {
+  const auto& pos_list = *segment.pos_list();
+  const auto& row_ids = pos_list.row_ids();
+  const auto& referenced_table = *segment.referenced_table();
+  const auto referenced_column_id = segment.referenced_column_id();
+  const auto referenced_segment = [&](const ChunkID chunk_id) {
+    return referenced_table.get_chunk(chunk_id).get_segment(referenced_column_id);
+  };
+
+  auto values = std::vector<T>(row_ids.size());
+  if (pos_list.benefits_from_grouping(0, row_ids.size())) {
+    const auto groups = pos_list.group_by_chunk(0, row_ids.size());
+    for (auto group_id = size_t{0}; group_id < groups.chunk_ids.size(); ++group_id) {
+      const auto* indices = groups.indices.data() + groups.group_begins[group_id];
+      const auto group_size = groups.group_begins[group_id + 1] - groups.group_begins[group_id];
+      gather<T>(
+          *referenced_segment(groups.chunk_ids[group_id]), group_size,
+          [&](const size_t index) { return row_ids[indices[index]].chunk_offset; },
+          [&](const size_t index, const T& value) { values[indices[index]] = value; });
+    }
+    return values;
+  }
+
+  auto group_begin = size_t{0};
+  while (group_begin < row_ids.size()) {
+    const auto chunk_id = row_ids[group_begin].chunk_id;
+    auto group_end = group_begin + 1;
+    while (group_end < row_ids.size() && row_ids[group_end].chunk_id == chunk_id) ++group_end;
+
+    gather<T>(
+        *referenced_segment(chunk_id), group_end - group_begin,
+        [&](const size_t index) { return row_ids[group_begin + index].chunk_offset; },
+        [&](const size_t index, const T& value) { values[group_begin + index] = value; });
+
+    group_begin = group_end;
+  }
+  return values;
+}
+
+template <typename T>
+std::vector<T> materialize_values(const BaseSegment& segment) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) return value_segment->values();
+
+  const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+  if (reference_segment && reference_segment->pos_list()->is_materialized() &&
+      !reference_segment->pos_list()->is_sorted()) {
+    return gather_unsorted<T>(*reference_segment);
+  }
+
+  // The values are accessed in ascending order, which the hardware prefetcher handles well
+  auto values = std::vector<T>{};
+  values.reserve(segment.size());
+  segment_for_each<T>(segment, [&](const T& value, const ChunkOffset) { values.push_back(value); });
+  return values;
+}
+
+}  // namespace
+
+Materialize::Materialize(const std::shared_ptr<const AbstractOperator> in,
+                         const std::optional<std::vector<ColumnID>>& column_ids)
+    : AbstractOperator(in), _column_ids(column_ids) {}
+
+const std::optional<std::vector<ColumnID>>& Materialize::column_ids() const { return _column_ids; }
+
+std::shared_ptr<const Table> Materialize::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto column_ids = std::vector<ColumnID>{};
+  if (_column_ids) {
+    column_ids = *_column_ids;
+  } else {
+    for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+      column_ids.push_back(column_id);
+    }
+  }
+
+  auto output_table = std::make_shared<Table>();
+  for (const auto& column_id : column_ids) {
+    Assert(column_id < input_table->column_count(), "Column does not exist");
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  const auto chunk_count = input_table->chunk_count();
+  auto output_segments = std::vector<std::vector<std::shared_ptr<BaseSegment>>>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    // Empty chunks are only materialized if the table has no rows, as tables always hold at least one chunk
+    if (chunk.size() == 0 && (chunk_id > 0 || input_table->row_count() > 0)) continue;
+
+    output_segments[chunk_id].resize(column_ids.size());
+    for (auto index = size_t{0}; index < column_ids.size(); ++index) {
+      const auto column_id = column_ids[index];
+      const auto& type = input_table->column_type(column_id);
+      const auto segment = chunk.column_count() > column_id ? chunk.get_segment(column_id) : nullptr;
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, index, type, segment]() {
+        resolve_data_type(type, [&](auto data_type) {
+          using Type = typename decltype(data_type)::type;
+          auto values = segment ? materialize_values<Type>(*segment) : std::vector<Type>{};
+          output_segments[chunk_id][index] = std::make_shared<ValueSegment<Type>>(std::move(values));
+        });
+      }));
+    }
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  for (auto& segments : output_segments) {
+    if (segments.empty()) continue;
+
+    auto chunk = Chunk{};
+    for (auto& segment : segments) chunk.add_segment(std::move(segment));
+    output_table->emplace_chunk(std::move(chunk));
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Materialize turns the output of its input operator, usually ReferenceSegments, into a table of ValueSegments, e.g.,
+// before handing a result to a client. Only the requested columns are materialized, in the requested order.
+//
+// The values are gathered with typed accessors, chunk by chunk and in position order, with one job per chunk and
+// column. Each output chunk holds the rows of one input chunk. If the positions of a ReferenceSegment are not sorted,
+// the value PREFETCH_DISTANCE positions ahead is prefetched, so that the cache misses of random accesses overlap.
+class Materialize : public AbstractOperator {
+ public:
+  static constexpr auto PREFETCH_DISTANCE = size_t{16};
+
+  // materializes the given columns of the input, or all of them if column_ids is std::nullopt
+  explicit Materialize(const std::shared_ptr<const AbstractOperator> in,
+                       const std::optional<std::vector<ColumnID>>& column_ids = std::nullopt);
+
+  const std::optional<std::vector<ColumnID>>& column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::optional<std::vector<ColumnID>> _column_ids;
+};
+
+}  // namespace opossum
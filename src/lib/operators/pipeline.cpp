@@ -0,0 +1,96 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_sink_operator.hpp"
+#include "abstract_streaming_operator.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns the first operator below the root that is not an AbstractStreamingOperator
+std::shared_ptr<const AbstractOperator> pipeline_input(const std::shared_ptr<const AbstractOperator>& root) {
+  auto input = root->input_left();
+  while (std::dynamic_pointer_cast<const AbstractStreamingOperator>(input)) input = input->input_left();
+  return input;
+}
+
+}  // namespace
+
+Pipeline::Pipeline(const std::shared_ptr<const AbstractOperator>& root) : AbstractOperator(pipeline_input(root)) {
+  _sink = std::dynamic_pointer_cast<const AbstractSinkOperator>(root);
+
+  auto stage = _sink ? root->input_left() : root;
+  while (const auto streaming_operator = std::dynamic_pointer_cast<const AbstractStreamingOperator>(stage)) {
+    _stages.push_back(streaming_operator);
+    stage = stage->input_left();
+  }
+  std::reverse(_stages.begin(), _stages.end());
+
+  Assert(_sink || !_stages.empty(), "The root of a Pipeline has to be a streaming or a sink operator");
+}
+
+const std::vector<std::shared_ptr<const AbstractStreamingOperator>>& Pipeline::stages() const { return _stages; }
+
+const std::shared_ptr<const AbstractSinkOperator>& Pipeline::sink() const { return _sink; }
+
+std::shared_ptr<const Table> Pipeline::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+  const auto sink = _sink ? _sink->make_sink(input_table, chunk_count) : nullptr;
+
+  // Each job keeps only the current chunk of its input chunk alive. The chunks of the stages consist of
+  // ReferenceSegments, which reference the data tables, so a chunk can be dropped as soon as the next one exists.
+  auto output_chunks = std::vector<std::optional<Chunk>>(sink ? 0 : chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& input_chunk = input_table->get_chunk(chunk_id);
+    if (input_chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto chunk = std::optional<Chunk>{};
+      for (const auto& stage : _stages) {
+        auto next_chunk = stage->process_chunk(input_table, chunk ? *chunk : input_chunk, chunk_id);
+        if (!next_chunk) return;
+        chunk = std::move(next_chunk);
+      }
+
+      if (sink) {
+        sink->consume(chunk_id, chunk ? *chunk : input_chunk);
+      } else {
+        output_chunks[chunk_id] = std::move(chunk);
+      }
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  if (sink) return sink->finish();
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  for (auto& output_chunk : output_chunks) {
+    if (output_chunk) output_table->emplace_chunk(std::move(*output_chunk));
+  }
+
+  // Operators expect their input to have all columns, even if it is empty
+  if (output_table->row_count() == 0) {
+    auto output_chunk = Chunk{};
+    _add_reference_segments(output_chunk, input_table, std::make_shared<PosList>());
+    output_table->emplace_chunk(std::move(output_chunk));
+  }
+  return output_table;
+}
+
+}  // namespace opossum
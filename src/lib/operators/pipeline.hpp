@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSinkOperator;
+class AbstractStreamingOperator;
+
+// Pipeline executes a chain of operators chunk by chunk instead of operator by operator, e.g., scan -> scan ->
+// aggregate. Executing the operators on their own materializes the complete output of each of them before the next
+// one starts. A Pipeline instead pushes each chunk of its input through all operators of the chain, so that the
+// intermediate chunks are consumed while they are still in the cache and never collected into tables.
+//
+// The chain consists of the AbstractStreamingOperators (the stages) below the root operator, and of the root itself,
+// which is either a stage as well or an AbstractSinkOperator. The first operator below the stages is the input of the
+// Pipeline. It is a pipeline breaker, e.g., a join or a Sort, whose output is materialized, so it has to be executed
+// before the Pipeline, like the inputs of any operator. The operators of the chain are not executed themselves.
+//
+// Each chunk of the input is processed by a job on the TaskScheduler. The output equals that of the root, except that
+// without a sink, the output chunks are the chunks that remain of the input chunks, in the same order.
+class Pipeline : public AbstractOperator {
+ public:
+  explicit Pipeline(const std::shared_ptr<const AbstractOperator>& root);
+
+  // the stages in the order in which the chunks pass them
+  const std::vector<std::shared_ptr<const AbstractStreamingOperator>>& stages() const;
+
+  // the root if it is an AbstractSinkOperator, nullptr otherwise
+  const std::shared_ptr<const AbstractSinkOperator>& sink() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::vector<std::shared_ptr<const AbstractStreamingOperator>> _stages;
+  std::shared_ptr<const AbstractSinkOperator> _sink;
+};
+
+}  // namespace opossum
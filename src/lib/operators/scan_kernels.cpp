@@ -0,0 +1,376 @@
+#include "scan_kernels.hpp"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <ScanType scan_type, typename T>
+bool compare(const T& lhs, const T& rhs) {
+  if constexpr (scan_type == ScanType::OpEquals) {
+    return lhs == rhs;
+  } else if constexpr (scan_type == ScanType::OpNotEquals) {
+    return lhs != rhs;
+  } else if constexpr (scan_type == ScanType::OpLessThan) {
+    return lhs < rhs;
+  } else if constexpr (scan_type == ScanType::OpLessThanEquals) {
+    return lhs <= rhs;
+  } else if constexpr (scan_type == ScanType::OpGreaterThan) {
+    return lhs > rhs;
+  } else {
+    return lhs >= rhs;
+  }
+}
+
+// calls functor with the scan type as a compile-time constant, which the vector instructions need as an immediate
+template <typename Functor>
+void with_scan_type(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(std::integral_constant<ScanType, ScanType::OpEquals>{});
+    case ScanType::OpNotEquals:
+      return functor(std::integral_constant<ScanType, ScanType::OpNotEquals>{});
+    case ScanType::OpLessThan:
+      return functor(std::integral_constant<ScanType, ScanType::OpLessThan>{});
+    case ScanType::OpLessThanEquals:
+      return functor(std::integral_constant<ScanType, ScanType::OpLessThanEquals>{});
+    case ScanType::OpGreaterThan:
+      return functor(std::integral_constant<ScanType, ScanType::OpGreaterThan>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(std::integral_constant<ScanType, ScanType::OpGreaterThanEquals>{});
+  }
+  Fail("Unknown scan type");
+}
+
+template <ScanType scan_type, typename T>
+void scan_values_scalar(const T* values, const size_t begin, const size_t count, const T search_value,
+                        const ChunkOffset base, std::vector<ChunkOffset>& matches) {
+  for (auto index = begin; index < count; ++index) {
+    if (compare<scan_type>(values[index], search_value)) matches.push_back(static_cast<ChunkOffset>(base + index));
+  }
+}
+
+template <typename Code>
+void scan_code_range_scalar(const Code* codes, const size_t begin, const size_t count, const Code range_begin,
+                            const Code width, const bool negated, const ChunkOffset base,
+                            std::vector<ChunkOffset>& matches) {
+  for (auto index = begin; index < count; ++index) {
+    // codes below range_begin wrap around, so a single comparison checks both bounds
+    const auto in_range = static_cast<Code>(codes[index] - range_begin) < width;
+    if (in_range != negated) matches.push_back(static_cast<ChunkOffset>(base + index));
+  }
+}
+
+// appends first + the position of each set bit of mask
+void append_mask(uint64_t mask, const size_t first, std::vector<ChunkOffset>& matches) {
+  while (mask) {
+    matches.push_back(static_cast<ChunkOffset>(first + __builtin_ctzll(mask)));
+    mask &= mask - 1;
+  }
+}
+
+#if defined(__x86_64__)
+
+// predicates for the floating-point comparisons, which behave like the scalar operators for NaN
+template <ScanType scan_type>
+constexpr int float_predicate() {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _CMP_EQ_OQ;
+    case ScanType::OpNotEquals:
+      return _CMP_NEQ_UQ;
+    case ScanType::OpLessThan:
+      return _CMP_LT_OQ;
+    case ScanType::OpLessThanEquals:
+      return _CMP_LE_OQ;
+    case ScanType::OpGreaterThan:
+      return _CMP_GT_OQ;
+    case ScanType::OpGreaterThanEquals:
+      return _CMP_GE_OQ;
+  }
+  return 0;
+}
+
+template <ScanType scan_type>
+constexpr int integer_predicate() {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _MM_CMPINT_EQ;
+    case ScanType::OpNotEquals:
+      return _MM_CMPINT_NE;
+    case ScanType::OpLessThan:
+      return _MM_CMPINT_LT;
+    case ScanType::OpLessThanEquals:
+      return _MM_CMPINT_LE;
+    case ScanType::OpGreaterThan:
+      return _MM_CMPINT_NLE;
+    case ScanType::OpGreaterThanEquals:
+      return _MM_CMPINT_NLT;
+  }
+  return 0;
+}
+
+// AVX2 only has equality and greater-than comparisons for signed integers. The other scan types are derived from them
+// by swapping the operands or by inverting the resulting bitmask (see inverts_integer_mask_avx2).
+template <ScanType scan_type, typename T>
+__attribute__((target("avx2"))) __m256i compare_integers_avx2(const __m256i lhs, const __m256i rhs) {
+  if constexpr (scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals) {
+    return sizeof(T) == 4 ? _mm256_cmpeq_epi32(lhs, rhs) : _mm256_cmpeq_epi64(lhs, rhs);
+  } else if constexpr (scan_type == ScanType::OpLessThan || scan_type == ScanType::OpGreaterThanEquals) {
+    return sizeof(T) == 4 ? _mm256_cmpgt_epi32(rhs, lhs) : _mm256_cmpgt_epi64(rhs, lhs);
+  } else {
+    return sizeof(T) == 4 ? _mm256_cmpgt_epi32(lhs, rhs) : _mm256_cmpgt_epi64(lhs, rhs);
+  }
+}
+
+template <ScanType scan_type>
+constexpr bool inverts_integer_mask_avx2() {
+  return scan_type == ScanType::OpNotEquals || scan_type == ScanType::OpLessThanEquals ||
+         scan_type == ScanType::OpGreaterThanEquals;
+}
+
+// Each kernel processes whole vectors and returns the number of values it processed. The remainder is scanned by the
+// scalar kernel.
+template <ScanType scan_type, typename T>
+__attribute__((target("avx2"))) size_t scan_values_avx2(const T* values, const size_t count, const T search_value,
+                                                        const ChunkOffset base, std::vector<ChunkOffset>& matches) {
+  constexpr auto LANES = sizeof(__m256i) / sizeof(T);
+  constexpr auto FULL_MASK = (uint64_t{1} << LANES) - 1;
+  constexpr auto PREDICATE = float_predicate<scan_type>();
+  auto index = size_t{0};
+
+  if constexpr (std::is_same_v<T, float>) {
+    const auto search_vector = _mm256_set1_ps(search_value);
+    for (; index + LANES <= count; index += LANES) {
+      const auto result = _mm256_cmp_ps(_mm256_loadu_ps(values + index), search_vector, PREDICATE);
+      append_mask(static_cast<uint32_t>(_mm256_movemask_ps(result)), base + index, matches);
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    const auto search_vector = _mm256_set1_pd(search_value);
+    for (; index + LANES <= count; index += LANES) {
+      const auto result = _mm256_cmp_pd(_mm256_loadu_pd(values + index), search_vector, PREDICATE);
+      append_mask(static_cast<uint32_t>(_mm256_movemask_pd(result)), base + index, matches);
+    }
+  } else {
+    constexpr auto INVERSION_MASK = inverts_integer_mask_avx2<scan_type>() ? FULL_MASK : uint64_t{0};
+    const auto search_vector = sizeof(T) == 4 ? _mm256_set1_epi32(static_cast<int32_t>(search_value))
+                                              : _mm256_set1_epi64x(static_cast<int64_t>(search_value));
+    for (; index + LANES <= count; index += LANES) {
+      const auto value_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+      const auto result = compare_integers_avx2<scan_type, T>(value_vector, search_vector);
+      const auto mask = static_cast<uint32_t>(sizeof(T) == 4 ? _mm256_movemask_ps(_mm256_castsi256_ps(result))
+                                                             : _mm256_movemask_pd(_mm256_castsi256_pd(result)));
+      append_mask(mask ^ INVERSION_MASK, base + index, matches);
+    }
+  }
+
+  return index;
+}
+
+template <ScanType scan_type, typename T>
+__attribute__((target("avx512f"))) size_t scan_values_avx512(const T* values, const size_t count,
+                                                             const T search_value, const ChunkOffset base,
+                                                             std::vector<ChunkOffset>& matches) {
+  constexpr auto LANES = sizeof(__m512i) / sizeof(T);
+  constexpr auto PREDICATE =
+      std::is_floating_point_v<T> ? float_predicate<scan_type>() : integer_predicate<scan_type>();
+  auto index = size_t{0};
+
+  if constexpr (std::is_same_v<T, float>) {
+    const auto search_vector = _mm512_set1_ps(search_value);
+    for (; index + LANES <= count; index += LANES) {
+      append_mask(_mm512_cmp_ps_mask(_mm512_loadu_ps(values + index), search_vector, PREDICATE), base + index, matches);
+    }
+  } else if constexpr (std::is_same_v<T, double>) {
+    const auto search_vector = _mm512_set1_pd(search_value);
+    for (; index + LANES <= count; index += LANES) {
+      append_mask(_mm512_cmp_pd_mask(_mm512_loadu_pd(values + index), search_vector, PREDICATE), base + index, matches);
+    }
+  } else if constexpr (sizeof(T) == 4) {
+    const auto search_vector = _mm512_set1_epi32(search_value);
+    for (; index + LANES <= count; index += LANES) {
+      const auto value_vector = _mm512_loadu_si512(values + index);
+      append_mask(_mm512_cmp_epi32_mask(value_vector, search_vector, PREDICATE), base + index, matches);
+    }
+  } else {
+    const auto search_vector = _mm512_set1_epi64(search_value);
+    for (; index + LANES <= count; index += LANES) {
+      const auto value_vector = _mm512_loadu_si512(values + index);
+      append_mask(_mm512_cmp_epi64_mask(value_vector, search_vector, PREDICATE), base + index, matches);
+    }
+  }
+
+  return index;
+}
+
+// AVX2 has no unsigned comparison. Instead, code - begin < width is checked as min(code - begin, width - 1) ==
+// code - begin. For 16-bit codes, the byte mask has two bits per code, of which every other one is extracted.
+template <typename Code>
+__attribute__((target("avx2,bmi2"))) size_t scan_code_range_avx2(const Code* codes, const size_t count,
+                                                                 const Code range_begin, const Code width,
+                                                                 const bool negated, const ChunkOffset base,
+                                                                 std::vector<ChunkOffset>& matches) {
+  constexpr auto LANES = sizeof(__m256i) / sizeof(Code);
+  constexpr auto FULL_MASK = (uint64_t{1} << LANES) - 1;
+  const auto inversion_mask = negated ? FULL_MASK : uint64_t{0};
+  auto index = size_t{0};
+
+  if constexpr (sizeof(Code) == 1) {
+    const auto begin_vector = _mm256_set1_epi8(static_cast<char>(range_begin));
+    const auto max_vector = _mm256_set1_epi8(static_cast<char>(width - 1));
+    for (; index + LANES <= count; index += LANES) {
+      const auto code_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + index));
+      const auto difference = _mm256_sub_epi8(code_vector, begin_vector);
+      const auto in_range = _mm256_cmpeq_epi8(_mm256_min_epu8(difference, max_vector), difference);
+      const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(in_range));
+      append_mask(mask ^ inversion_mask, base + index, matches);
+    }
+  } else if constexpr (sizeof(Code) == 2) {
+    const auto begin_vector = _mm256_set1_epi16(static_cast<int16_t>(range_begin));
+    const auto max_vector = _mm256_set1_epi16(static_cast<int16_t>(width - 1));
+    for (; index + LANES <= count; index += LANES) {
+      const auto code_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + index));
+      const auto difference = _mm256_sub_epi16(code_vector, begin_vector);
+      const auto in_range = _mm256_cmpeq_epi16(_mm256_min_epu16(difference, max_vector), difference);
+      const auto mask = _pext_u32(static_cast<uint32_t>(_mm256_movemask_epi8(in_range)), 0x55555555u);
+      append_mask(mask ^ inversion_mask, base + index, matches);
+    }
+  } else {
+    const auto begin_vector = _mm256_set1_epi32(static_cast<int32_t>(range_begin));
+    const auto max_vector = _mm256_set1_epi32(static_cast<int32_t>(width - 1));
+    for (; index + LANES <= count; index += LANES) {
+      const auto code_vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + index));
+      const auto difference = _mm256_sub_epi32(code_vector, begin_vector);
+      const auto in_range = _mm256_cmpeq_epi32(_mm256_min_epu32(difference, max_vector), difference);
+      const auto mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(in_range)));
+      append_mask(mask ^ inversion_mask, base + index, matches);
+    }
+  }
+
+  return index;
+}
+
+template <typename Code>
+__attribute__((target("avx512f,avx512bw"))) size_t scan_code_range_avx512(const Code* codes, const size_t count,
+                                                                          const Code range_begin, const Code width,
+                                                                          const bool negated, const ChunkOffset base,
+                                                                          std::vector<ChunkOffset>& matches) {
+  constexpr auto LANES = sizeof(__m512i) / sizeof(Code);
+  constexpr auto FULL_MASK = LANES == 64 ? ~uint64_t{0} : (uint64_t{1} << LANES) - 1;
+  const auto inversion_mask = negated ? FULL_MASK : uint64_t{0};
+  auto index = size_t{0};
+
+  if constexpr (sizeof(Code) == 1) {
+    const auto begin_vector = _mm512_set1_epi8(static_cast<char>(range_begin));
+    const auto width_vector = _mm512_set1_epi8(static_cast<char>(width));
+    for (; index + LANES <= count; index += LANES) {
+      const auto difference = _mm512_sub_epi8(_mm512_loadu_si512(codes + index), begin_vector);
+      const auto mask = _mm512_cmp_epu8_mask(difference, width_vector, _MM_CMPINT_LT);
+      append_mask(mask ^ inversion_mask, base + index, matches);
+    }
+  } else if constexpr (sizeof(Code) == 2) {
+    const auto begin_vector = _mm512_set1_epi16(static_cast<int16_t>(range_begin));
+    const auto width_vector = _mm512_set1_epi16(static_cast<int16_t>(width));
+    for (; index + LANES <= count; index += LANES) {
+      const auto difference = _mm512_sub_epi16(_mm512_loadu_si512(codes + index), begin_vector);
+      const auto mask = _mm512_cmp_epu16_mask(difference, width_vector, _MM_CMPINT_LT);
+      append_mask(mask ^ inversion_mask, base + index, matches);
+    }
+  } else {
+    const auto begin_vector = _mm512_set1_epi32(static_cast<int32_t>(range_begin));
+    const auto width_vector = _mm512_set1_epi32(static_cast<int32_t>(width));
+    for (; index + LANES <= count; index += LANES) {
+      const auto difference = _mm512_sub_epi32(_mm512_loadu_si512(codes + index), begin_vector);
+      const auto mask = _mm512_cmp_epu32_mask(difference, width_vector, _MM_CMPINT_LT);
+      append_mask(mask ^ inversion_mask, base + index, matches);
+    }
+  }
+
+  return index;
+}
+
+#endif
+
+}  // namespace
+
+SimdLevel supported_simd_level() {
+  static const auto simd_level = [] {
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2")) return SimdLevel::AVX2;
+#endif
+    return SimdLevel::Scalar;
+  }();
+  return simd_level;
+}
+
+template <typename T>
+void scan_values(const T* values, const size_t count, const ScanType scan_type, const T search_value,
+                 const ChunkOffset base, std::vector<ChunkOffset>& matches, const SimdLevel simd_level) {
+  Assert(simd_level <= supported_simd_level(), "Instruction set is not supported by the CPU");
+
+  with_scan_type(scan_type, [&](const auto scan_type_constant) {
+    constexpr auto SCAN_TYPE = decltype(scan_type_constant)::value;
+    auto index = size_t{0};
+#if defined(__x86_64__)
+    if (simd_level == SimdLevel::AVX512) {
+      index = scan_values_avx512<SCAN_TYPE>(values, count, search_value, base, matches);
+    } else if (simd_level == SimdLevel::AVX2) {
+      index = scan_values_avx2<SCAN_TYPE>(values, count, search_value, base, matches);
+    }
+#endif
+    scan_values_scalar<SCAN_TYPE>(values, index, count, search_value, base, matches);
+  });
+}
+
+template <typename Code>
+void scan_code_range(const Code* codes, const size_t count, const Code begin, const Code width, const bool negated,
+                     const ChunkOffset base, std::vector<ChunkOffset>& matches, const SimdLevel simd_level) {
+  Assert(simd_level <= supported_simd_level(), "Instruction set is not supported by the CPU");
+
+  // the vector kernels compare against width - 1
+  if (width == 0) {
+    if (!negated) return;
+    for (auto index = size_t{0}; index < count; ++index) matches.push_back(static_cast<ChunkOffset>(base + index));
+    return;
+  }
+
+  auto index = size_t{0};
+#if defined(__x86_64__)
+  if (simd_level == SimdLevel::AVX512) {
+    index = scan_code_range_avx512(codes, count, begin, width, negated, base, matches);
+  } else if (simd_level == SimdLevel::AVX2) {
+    index = scan_code_range_avx2(codes, count, begin, width, negated, base, matches);
+  }
+#endif
+  scan_code_range_scalar(codes, index, count, begin, width, negated, base, matches);
+}
+
+template void scan_values<int32_t>(const int32_t*, const size_t, const ScanType, const int32_t, const ChunkOffset,
+                                   std::vector<ChunkOffset>&, const SimdLevel);
+template void scan_values<int64_t>(const int64_t*, const size_t, const ScanType, const int64_t, const ChunkOffset,
+                                   std::vector<ChunkOffset>&, const SimdLevel);
+template void scan_values<float>(const float*, const size_t, const ScanType, const float, const ChunkOffset,
+                                 std::vector<ChunkOffset>&, const SimdLevel);
+template void scan_values<double>(const double*, const size_t, const ScanType, const double, const ChunkOffset,
+                                  std::vector<ChunkOffset>&, const SimdLevel);
+
+template void scan_code_range<uint8_t>(const uint8_t*, const size_t, const uint8_t, const uint8_t, const bool,
+                                       const ChunkOffset, std::vector<ChunkOffset>&, const SimdLevel);
+template void scan_code_range<uint16_t>(const uint16_t*, const size_t, const uint16_t, const uint16_t, const bool,
+                                        const ChunkOffset, std::vector<ChunkOffset>&, const SimdLevel);
+template void scan_code_range<uint32_t>(const uint32_t*, const size_t, const uint32_t, const uint32_t, const bool,
+                                        const ChunkOffset, std::vector<ChunkOffset>&, const SimdLevel);
+
+}  // namespace opossum
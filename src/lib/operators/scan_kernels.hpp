@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Instruction sets that the scan kernels can use. The kernels for all of them are compiled into the binary and the
+// most capable one that the CPU supports is selected at runtime (cpuid), so that the binary still runs on CPUs without
+// AVX2 or AVX-512.
+enum class SimdLevel { Scalar, AVX2, AVX512 };
+
+// returns the most capable instruction set that the CPU supports
+SimdLevel supported_simd_level();
+
+// Appends base + index to matches for each index in [0, count) for which "values[index] <scan_type> search_value"
+// holds. The comparisons produce a bitmask per vector of 8 to 16 values (AVX2/AVX-512), which is then compacted into
+// positions. T can be int32_t, int64_t, float, or double.
+template <typename T>
+void scan_values(const T* values, const size_t count, const ScanType scan_type, const T search_value,
+                 const ChunkOffset base, std::vector<ChunkOffset>& matches,
+                 const SimdLevel simd_level = supported_simd_level());
+
+// Appends base + index to matches for each index in [0, count) for which begin <= codes[index] < begin + width holds,
+// or, if negated, does not hold. This evaluates a range of value ids on a fixed-size attribute vector, where a vector
+// compares 32 to 64 8-bit codes at once. Code can be uint8_t, uint16_t, or uint32_t.
+template <typename Code>
+void scan_code_range(const Code* codes, const size_t count, const Code begin, const Code width, const bool negated,
+                     const ChunkOffset base, std::vector<ChunkOffset>& matches,
+                     const SimdLevel simd_level = supported_simd_level());
+
+}  // namespace opossum
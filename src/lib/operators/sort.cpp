@@ -0,0 +1,106 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "sort_column.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions)
+    : AbstractOperator(in), _sort_definitions(sort_definitions) {}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto sort_columns = std::vector<std::unique_ptr<BaseSortColumn>>{};
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column_id < input_table->column_count(), "Column does not exist");
+    sort_columns.emplace_back(make_unique_by_data_type<BaseSortColumn, SortColumn>(
+        input_table->column_type(sort_definition.column_id), chunk_count, sort_definition.order_by_mode));
+  }
+
+  // sort each chunk
+  auto sorted_offsets = std::vector<std::vector<ChunkOffset>>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& offsets = sorted_offsets[chunk_id];
+      offsets.resize(chunk.size());
+      std::iota(offsets.begin(), offsets.end(), ChunkOffset{0});
+
+      for (auto index = size_t{0}; index < sort_columns.size(); ++index) {
+        sort_columns[index]->materialize(chunk_id, *chunk.get_segment(_sort_definitions[index].column_id));
+      }
+      for (auto index = sort_columns.size(); index > 0; --index) {
+        sort_columns[index - 1]->sort(chunk_id, *chunk.get_segment(_sort_definitions[index - 1].column_id), offsets);
+      }
+      for (auto& sort_column : sort_columns) sort_column->reorder(chunk_id, offsets);
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  // Merge the sorted chunks. The heap holds the chunk and the index of the next row of each chunk. Of equal rows, the
+  // one of the lower chunk comes first, so the sort is stable.
+  using Cursor = std::pair<ChunkID, size_t>;
+  const auto comes_after = [&](const Cursor& lhs, const Cursor& rhs) {
+    for (const auto& sort_column : sort_columns) {
+      const auto result = sort_column->compare(lhs.first, lhs.second, rhs.first, rhs.second);
+      if (result != 0) return result > 0;
+    }
+    return lhs.first > rhs.first;
+  };
+  auto heap = std::priority_queue<Cursor, std::vector<Cursor>, decltype(comes_after)>{comes_after};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!sorted_offsets[chunk_id].empty()) heap.emplace(chunk_id, 0);
+  }
+
+  auto pos_lists = std::vector<std::shared_ptr<PosList>>{};
+  while (!heap.empty()) {
+    auto [chunk_id, index] = heap.top();
+    heap.pop();
+
+    if (pos_lists.empty() || pos_lists.back()->size() == OUTPUT_CHUNK_SIZE) {
+      pos_lists.emplace_back(std::make_shared<PosList>());
+      pos_lists.back()->reserve(OUTPUT_CHUNK_SIZE);
+    }
+    pos_lists.back()->push_back(RowID{chunk_id, sorted_offsets[chunk_id][index]});
+
+    if (++index < sorted_offsets[chunk_id].size()) heap.emplace(chunk_id, index);
+  }
+  if (pos_lists.empty()) pos_lists.emplace_back(std::make_shared<PosList>());
+
+  auto output_chunks = std::vector<Chunk>(pos_lists.size());
+  jobs.clear();
+  for (auto index = size_t{0}; index < pos_lists.size(); ++index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, index]() {
+      _add_reference_segments(output_chunks[index], input_table, pos_lists[index]);
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  for (auto& output_chunk : output_chunks) output_table->emplace_chunk(std::move(output_chunk));
+  return output_table;
+}
+
+}  // namespace opossum
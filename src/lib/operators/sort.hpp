@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class OrderByMode { Ascending, Descending };
+
+struct SortColumnDefinition {
+  ColumnID column_id;
+  OrderByMode order_by_mode = OrderByMode::Ascending;
+};
+
+// Sorts the rows of the input by the given columns, the first one taking precedence. Rows with equal values keep their
+// order. The output consists of ReferenceSegments with up to OUTPUT_CHUNK_SIZE rows per chunk.
+//
+// Each chunk is sorted by a job on the TaskScheduler, with a stable sort per column from the last column to the first.
+// For DictionarySegments, the chunk is sorted by the ValueIDs, which are ordered like the values, as the dictionary is
+// sorted. ValueIDs and integral values are sorted with a radix sort. The sorted chunks are then combined with a k-way
+// merge that compares the values of the sort columns, which are materialized in the order of their chunk.
+class Sort : public AbstractOperator {
+ public:
+  static constexpr auto OUTPUT_CHUNK_SIZE = size_t{65'536};
+
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "sort.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
+#include "types.hpp"
+#include "utils/radix_sort.hpp"
+
+namespace opossum {
+
+// BaseSortColumn holds the values of a column that rows are ordered by (see Sort and TopK), materialized per chunk. It
+// hides the data type of the column from the operators, which only compare rows by their chunk and index.
+class BaseSortColumn {
+ public:
+  virtual ~BaseSortColumn() = default;
+
+  // materializes the values of the segment of a chunk in the order of the chunk
+  virtual void materialize(const ChunkID chunk_id, const BaseSegment& segment) = 0;
+
+  // sorts the offsets of a chunk stably by the values of the segment
+  virtual void sort(const ChunkID chunk_id, const BaseSegment& segment, std::vector<ChunkOffset>& offsets) const = 0;
+
+  // arranges the materialized values of a chunk in the order of the sorted offsets
+  virtual void reorder(const ChunkID chunk_id, const std::vector<ChunkOffset>& offsets) = 0;
+
+  // Compares the index-th value of one chunk with that of another chunk after reordering. Returns a negative number if
+  // the first value comes first in the requested order, a positive one if it comes last, and zero if they are equal.
+  virtual int compare(const ChunkID chunk_id, const size_t index, const ChunkID other_chunk_id,
+                      const size_t other_index) const = 0;
+
+  // returns whether all values of a segment with the given statistics come after the index-th value of a chunk
+  virtual bool comes_after(const BaseSegmentStatistics& statistics, const ChunkID chunk_id,
+                           const size_t index) const = 0;
+};
+
+template <typename T>
+class SortColumn final : public BaseSortColumn {
+ public:
+  SortColumn(const ChunkID chunk_count, const OrderByMode order_by_mode)
+      : _values(chunk_count), _descending(order_by_mode == OrderByMode::Descending) {}
+
+  void materialize(const ChunkID chunk_id, const BaseSegment& segment) final {
+    auto& values = _values[chunk_id];
+    values.reserve(segment.size());
+    segment_for_each<T>(segment, [&](const T& value, const ChunkOffset) { values.push_back(value); });
+  }
+
+  void sort(const ChunkID chunk_id, const BaseSegment& segment, std::vector<ChunkOffset>& offsets) const final {
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+      auto keyed_offsets = std::vector<std::pair<ValueID::base_type, ChunkOffset>>(offsets.size());
+      resolve_attribute_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        for (auto index = size_t{0}; index < offsets.size(); ++index) {
+          const auto value_id = static_cast<ValueID::base_type>(attribute_vector.get(offsets[index]));
+          keyed_offsets[index] = {_descending ? ~value_id : value_id, offsets[index]};
+        }
+      });
+      _radix_sort(keyed_offsets, offsets);
+      return;
+    }
+
+    const auto& values = _values[chunk_id];
+    if constexpr (std::is_integral_v<T>) {
+      // flipping all bits reverses the order of signed and unsigned integers without overflows
+      auto keyed_offsets = std::vector<std::pair<T, ChunkOffset>>(offsets.size());
+      for (auto index = size_t{0}; index < offsets.size(); ++index) {
+        const auto& value = values[offsets[index]];
+        keyed_offsets[index] = {_descending ? static_cast<T>(~value) : value, offsets[index]};
+      }
+      _radix_sort(keyed_offsets, offsets);
+    } else if (_descending) {
+      std::stable_sort(offsets.begin(), offsets.end(),
+                       [&](const ChunkOffset lhs, const ChunkOffset rhs) { return values[rhs] < values[lhs]; });
+    } else {
+      std::stable_sort(offsets.begin(), offsets.end(),
+                       [&](const ChunkOffset lhs, const ChunkOffset rhs) { return values[lhs] < values[rhs]; });
+    }
+  }
+
+  void reorder(const ChunkID chunk_id, const std::vector<ChunkOffset>& offsets) final {
+    auto& values = _values[chunk_id];
+    auto reordered_values = std::vector<T>{};
+    reordered_values.reserve(values.size());
+    for (const auto chunk_offset : offsets) reordered_values.push_back(std::move(values[chunk_offset]));
+    values = std::move(reordered_values);
+  }
+
+  int compare(const ChunkID chunk_id, const size_t index, const ChunkID other_chunk_id,
+              const size_t other_index) const final {
+    const auto& value = _values[chunk_id][index];
+    const auto& other_value = _values[other_chunk_id][other_index];
+    if (value < other_value) return _descending ? 1 : -1;
+    if (other_value < value) return _descending ? -1 : 1;
+    return 0;
+  }
+
+  bool comes_after(const BaseSegmentStatistics& statistics, const ChunkID chunk_id, const size_t index) const final {
+    const auto& typed_statistics = static_cast<const SegmentStatistics<T>&>(statistics);
+    const auto& value = _values[chunk_id][index];
+    return _descending ? typed_statistics.max() < value : value < typed_statistics.min();
+  }
+
+ private:
+  template <typename Key>
+  static void _radix_sort(std::vector<std::pair<Key, ChunkOffset>>& keyed_offsets, std::vector<ChunkOffset>& offsets) {
+    radix_sort(keyed_offsets);
+    for (auto index = size_t{0}; index < offsets.size(); ++index) offsets[index] = keyed_offsets[index].second;
+  }
+
+  std::vector<std::vector<T>> _values;
+  const bool _descending;
+};
+
+}  // namespace opossum
@@ -0,0 +1,560 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scan_kernels.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+class BaseTableScanImpl {
+ public:
+  virtual ~BaseTableScanImpl() = default;
+
+  virtual std::shared_ptr<const Table> on_execute() = 0;
+
+  // scans a single chunk, see TableScan::process_chunk
+  virtual std::optional<Chunk> scan_chunk(const Chunk& chunk, const ChunkID chunk_id) = 0;
+};
+
+namespace {
+
+// calls functor with the comparator (e.g., std::less<>) that corresponds to the scan type
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return functor(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return functor(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return functor(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return functor(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(std::greater_equal<>{});
+  }
+  Fail("Unknown scan type");
+}
+
+// The value ids in [begin, end) match the predicate, or, if negated, all others do
+struct ValueIDRange {
+  ValueID::base_type begin;
+  ValueID::base_type end;
+  bool negated;
+
+  bool matches_none(const size_t dictionary_size) const {
+    return negated ? begin == 0 && end == dictionary_size : begin == end;
+  }
+
+  bool matches_all(const size_t dictionary_size) const {
+    return negated ? begin == end : begin == 0 && end == dictionary_size;
+  }
+};
+
+// maps the position lists of an input chunk to the filtered position lists of the output chunk
+using PosListMapping = std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>>;
+
+// offset_at for scans over a contiguous range of a segment
+struct ContiguousOffsets {
+  ChunkOffset operator()(const size_t index) const { return static_cast<ChunkOffset>(begin + index); }
+
+  ChunkOffset begin;
+};
+
+}  // namespace
+
+template <typename T>
+class TableScanImpl : public BaseTableScanImpl {
+ public:
+  TableScanImpl(const std::shared_ptr<const Table>& input_table, const ColumnID column_id, const ScanType scan_type,
+                const AllTypeVariant& search_value)
+      : _input_table(input_table),
+        _column_id(column_id),
+        _scan_type(scan_type),
+        _search_value_variant(search_value),
+        _search_value(type_cast<T>(search_value)) {}
+
+  std::shared_ptr<const Table> on_execute() override {
+    auto output_table = std::make_shared<Table>();
+    for (auto column_id = ColumnID{0}; column_id < _input_table->column_count(); ++column_id) {
+      output_table->add_column_definition(_input_table->column_name(column_id), _input_table->column_type(column_id));
+    }
+
+    // Each job scans a morsel of a chunk into its own list of matches. The lists are concatenated in chunk order
+    // afterwards, so the output does not depend on the order in which the jobs finish.
+    const auto chunk_count = _input_table->chunk_count();
+    auto morsel_matches = std::vector<std::vector<std::vector<ChunkOffset>>>(chunk_count);
+    auto chunk_scans = std::vector<std::optional<ChunkScan>>(chunk_count);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      chunk_scans[chunk_id] = _prepare_scan(_input_table->get_chunk(chunk_id));
+      if (!chunk_scans[chunk_id]) continue;
+
+      const auto scanned_size = chunk_scans[chunk_id]->scanned_size;
+      const auto morsel_count = (scanned_size + TableScan::MORSEL_SIZE - 1) / TableScan::MORSEL_SIZE;
+      morsel_matches[chunk_id].resize(morsel_count);
+      for (auto morsel_id = size_t{0}; morsel_id < morsel_count; ++morsel_id) {
+        const auto begin = static_cast<ChunkOffset>(morsel_id * TableScan::MORSEL_SIZE);
+        const auto end = static_cast<ChunkOffset>(std::min(scanned_size, (morsel_id + 1) * TableScan::MORSEL_SIZE));
+        jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, morsel_id, begin, end]() {
+          _scan(*chunk_scans[chunk_id], begin, end, morsel_matches[chunk_id][morsel_id]);
+        }));
+      }
+    }
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+    // The output chunks are created concurrently as well, as filtering the position lists touches every match again
+    auto output_chunks = std::vector<std::optional<Chunk>>(chunk_count);
+    jobs.clear();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      auto& chunk_morsel_matches = morsel_matches[chunk_id];
+      const auto has_matches = std::any_of(chunk_morsel_matches.cbegin(), chunk_morsel_matches.cend(),
+                                           [](const auto& matches) { return !matches.empty(); });
+      if (!has_matches) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto matches = std::move(chunk_morsel_matches.front());
+        for (auto morsel_id = size_t{1}; morsel_id < chunk_morsel_matches.size(); ++morsel_id) {
+          const auto& next_matches = chunk_morsel_matches[morsel_id];
+          matches.insert(matches.end(), next_matches.cbegin(), next_matches.cend());
+        }
+        output_chunks[chunk_id] =
+            _matching_chunk(_input_table->get_chunk(chunk_id), chunk_id, *chunk_scans[chunk_id], std::move(matches));
+      }));
+    }
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+    for (auto& output_chunk : output_chunks) {
+      if (output_chunk) output_table->emplace_chunk(std::move(*output_chunk));
+    }
+
+    // Operators expect their input to have all columns, even if it is empty
+    if (output_table->row_count() == 0) {
+      output_table->emplace_chunk(_output_chunk(_input_table->get_chunk(ChunkID{0}), ChunkID{0}, {}));
+    }
+
+    return output_table;
+  }
+
+  std::optional<Chunk> scan_chunk(const Chunk& chunk, const ChunkID chunk_id) override {
+    const auto chunk_scan = _prepare_scan(chunk);
+    if (!chunk_scan) return std::nullopt;
+
+    auto matches = std::vector<ChunkOffset>{};
+    _scan(*chunk_scan, ChunkOffset{0}, static_cast<ChunkOffset>(chunk_scan->scanned_size), matches);
+    if (matches.empty()) return std::nullopt;
+    return _matching_chunk(chunk, chunk_id, *chunk_scan, std::move(matches));
+  }
+
+ protected:
+  // The segment that is scanned for an input chunk. If the input chunk references a dense selection (a bitmap) of a
+  // data chunk, e.g., the output of a previous scan, the referenced segment is scanned as a whole with the vectorized
+  // kernels instead of gathering the selected values. The matches are then intersected with the input selection by a
+  // bitwise AND.
+  struct ChunkScan {
+    std::shared_ptr<const BaseSegment> data_segment;
+    std::shared_ptr<const ReferenceSegment> reference_segment;
+    size_t scanned_size;
+    std::shared_ptr<const ChunkSelection> input_selection;
+  };
+
+  // returns std::nullopt if the chunk is empty or can be pruned
+  std::optional<ChunkScan> _prepare_scan(const Chunk& chunk) const {
+    if (chunk.size() == 0) return std::nullopt;
+
+    const auto segment = chunk.get_segment(_column_id);
+    auto chunk_scan =
+        ChunkScan{segment, std::dynamic_pointer_cast<const ReferenceSegment>(segment), chunk.size(), nullptr};
+    if (!chunk_scan.reference_segment) {
+      if (_can_prune(chunk)) return std::nullopt;
+      return chunk_scan;
+    }
+
+    chunk_scan.data_segment = nullptr;
+    const auto& pos_list = *chunk_scan.reference_segment->pos_list();
+    const auto& selection = pos_list.selection();
+    if (selection && selection->is_bitmap()) {
+      const auto& referenced_table = *chunk_scan.reference_segment->referenced_table();
+      const auto& referenced_chunk = referenced_table.get_chunk(pos_list.single_chunk_id());
+      if (_can_prune(referenced_chunk)) return std::nullopt;
+      chunk_scan.data_segment = referenced_chunk.get_segment(chunk_scan.reference_segment->referenced_column_id());
+      chunk_scan.scanned_size = selection->chunk_size();
+      chunk_scan.input_selection = selection;
+    }
+    return chunk_scan;
+  }
+
+  // appends the offsets in [begin, end) of the scanned segment whose values match to matches
+  void _scan(const ChunkScan& chunk_scan, const ChunkOffset begin, const ChunkOffset end,
+             std::vector<ChunkOffset>& matches) const {
+    if (chunk_scan.data_segment) {
+      _scan_data_segment(*chunk_scan.data_segment, begin, end, matches);
+    } else {
+      _scan_reference_segment(*chunk_scan.reference_segment, begin, end, matches);
+    }
+  }
+
+  // creates the output chunk for the matches of the scanned segment, or std::nullopt if none of them remains
+  std::optional<Chunk> _matching_chunk(const Chunk& input_chunk, const ChunkID chunk_id, const ChunkScan& chunk_scan,
+                                       std::vector<ChunkOffset> matches) const {
+    const auto& input_selection = chunk_scan.input_selection;
+    if (!input_selection) return _output_chunk(input_chunk, chunk_id, matches);
+
+    const auto selection = std::make_shared<const ChunkSelection>(
+        input_selection->intersect(ChunkSelection{input_selection->chunk_size(), std::move(matches)}));
+    if (selection->size() == 0) return std::nullopt;
+
+    // The columns that share the input selection reference the intersection. Other columns are filtered by the
+    // indices of the matches within the input selection.
+    auto matching_offsets = std::vector<ChunkOffset>{};
+    matching_offsets.reserve(selection->size());
+    selection->for_each([&](const ChunkOffset chunk_offset) {
+      matching_offsets.push_back(static_cast<ChunkOffset>(input_selection->rank(chunk_offset)));
+    });
+    const auto& input_pos_list = chunk_scan.reference_segment->pos_list();
+    const auto output_pos_list = PosList::chunk_selection(input_pos_list->single_chunk_id(), selection);
+    return _output_chunk(input_chunk, chunk_id, matching_offsets, {{input_pos_list, output_pos_list}});
+  }
+
+  // Checks the statistics and the Bloom filter of the scanned segment, if they exist
+  bool _can_prune(const Chunk& chunk) const {
+    const auto statistics = chunk.get_segment_statistics(_column_id);
+    if (statistics && statistics->can_prune(_scan_type, _search_value_variant)) return true;
+
+    if (_scan_type != ScanType::OpEquals) return false;
+    const auto bloom_filter = chunk.get_segment_bloom_filter(_column_id);
+    return bloom_filter && !bloom_filter->may_contain(_search_value);
+  }
+
+  ValueIDRange _value_id_range(const DictionarySegment<T>& segment) const {
+    const auto dictionary_size = static_cast<ValueID::base_type>(segment.unique_values_count());
+    const auto bound = [&](const ValueID value_id) {
+      return value_id == INVALID_VALUE_ID ? dictionary_size : static_cast<ValueID::base_type>(value_id);
+    };
+    const auto lower_bound = bound(segment.lower_bound(_search_value));
+    const auto upper_bound = bound(segment.upper_bound(_search_value));
+
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return {lower_bound, upper_bound, false};
+      case ScanType::OpNotEquals:
+        return {lower_bound, upper_bound, true};
+      case ScanType::OpLessThan:
+        return {0, lower_bound, false};
+      case ScanType::OpLessThanEquals:
+        return {0, upper_bound, false};
+      case ScanType::OpGreaterThan:
+        return {upper_bound, dictionary_size, false};
+      case ScanType::OpGreaterThanEquals:
+        return {lower_bound, dictionary_size, false};
+    }
+    Fail("Unknown scan type");
+  }
+
+  // Appends base + index to matches for each index in [0, count) for which the value at offset_at(index) matches. The
+  // values are not decoded, only their value ids are compared against the range that the predicate translates to.
+  // Contiguous ranges of fixed-size attribute vectors are compared with vector instructions.
+  template <typename OffsetAt>
+  void _scan_dictionary_segment(const DictionarySegment<T>& segment, const size_t count, const OffsetAt& offset_at,
+                                const ChunkOffset base, std::vector<ChunkOffset>& matches) const {
+    const auto range = _value_id_range(segment);
+    const auto dictionary_size = segment.unique_values_count();
+    if (range.matches_none(dictionary_size)) return;
+
+    if (range.matches_all(dictionary_size)) {
+      for (auto index = size_t{0}; index < count; ++index) matches.push_back(static_cast<ChunkOffset>(base + index));
+      return;
+    }
+
+    const auto range_width = range.end - range.begin;
+    resolve_attribute_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+      using AttributeVectorType = std::decay_t<decltype(attribute_vector)>;
+
+      if constexpr (std::is_same_v<OffsetAt, ContiguousOffsets> &&
+                    !std::is_same_v<AttributeVectorType, BitPackedAttributeVector>) {
+        // the range fits into the width of the codes, as it lies within the dictionary
+        using Code = typename std::decay_t<decltype(attribute_vector.values())>::value_type;
+        scan_code_range(attribute_vector.values().data() + offset_at.begin, count, static_cast<Code>(range.begin),
+                        static_cast<Code>(range_width), range.negated, base, matches);
+      } else {
+        // A single unsigned comparison checks both bounds, as value ids below begin wrap around
+        for (auto index = size_t{0}; index < count; ++index) {
+          const auto value_id = static_cast<ValueID::base_type>(attribute_vector.get(offset_at(index)));
+          if ((value_id - range.begin < range_width) != range.negated) {
+            matches.push_back(static_cast<ChunkOffset>(base + index));
+          }
+        }
+      }
+    });
+  }
+
+  // appends the offsets in [begin, end) of the segment whose values match to matches
+  void _scan_data_segment(const BaseSegment& segment, const ChunkOffset begin, const ChunkOffset end,
+                          std::vector<ChunkOffset>& matches) const {
+    resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+      const auto count = size_t{end - begin};
+
+      if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+        _scan_dictionary_segment(typed_segment, count, ContiguousOffsets{begin}, begin, matches);
+      } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+        // each run is compared only once
+        const auto& values = typed_segment.values();
+        const auto& end_positions = typed_segment.end_positions();
+        with_comparator(_scan_type, [&](const auto& comparator) {
+          auto run_index = static_cast<size_t>(
+              std::lower_bound(end_positions.cbegin(), end_positions.cend(), begin) - end_positions.cbegin());
+          for (auto run_begin = begin; run_begin < end; ++run_index) {
+            const auto run_end = std::min(end_positions[run_index] + 1, end);
+            if (comparator(values[run_index], _search_value)) {
+              for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+                matches.push_back(chunk_offset);
+              }
+            }
+            run_begin = run_end;
+          }
+        });
+      } else if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+        Fail("Reference segments have to reference data segments");
+      } else if constexpr (std::is_same_v<SegmentType, ValueSegment<T>> && std::is_arithmetic_v<T>) {
+        scan_values(typed_segment.values().data() + begin, count, _scan_type, _search_value, begin, matches);
+      } else if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+        with_comparator(_scan_type, [&](const auto& comparator) {
+          const auto& values = typed_segment.values();
+          for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+            if (comparator(values[chunk_offset], _search_value)) matches.push_back(chunk_offset);
+          }
+        });
+      } else {
+        // FrameOfReferenceSegment, decoded block by block
+        auto block = std::vector<T>{};
+        const auto first_block_index = begin / SegmentType::BLOCK_SIZE;
+        const auto last_block_index = (end - 1) / SegmentType::BLOCK_SIZE;
+        for (auto block_index = first_block_index; block_index <= last_block_index; ++block_index) {
+          typed_segment.decode_block(block_index, block);
+          const auto block_begin = static_cast<ChunkOffset>(block_index * SegmentType::BLOCK_SIZE);
+          const auto scan_begin = std::max(begin, block_begin);
+          const auto scan_end = std::min(end, static_cast<ChunkOffset>(block_begin + block.size()));
+          scan_values(block.data() + (scan_begin - block_begin), scan_end - scan_begin, _scan_type, _search_value,
+                      scan_begin, matches);
+        }
+      }
+    });
+  }
+
+  // Scans the values referenced by the positions in [begin, end). Positions in the same chunk are scanned together, so
+  // that the referenced chunk is pruned and its segment is resolved only once per group. Usually, the groups are runs
+  // of consecutive positions. If the positions switch between chunks too often, they are grouped by chunk first. If
+  // they reference an entire chunk, its segment is scanned like an input data segment.
+  void _scan_reference_segment(const ReferenceSegment& segment, const ChunkOffset begin, const ChunkOffset end,
+                               std::vector<ChunkOffset>& matches) const {
+    const auto& pos_list = *segment.pos_list();
+    const auto& referenced_table = *segment.referenced_table();
+    const auto referenced_column_id = segment.referenced_column_id();
+
+    if (pos_list.is_entire_chunk()) {
+      const auto& referenced_chunk = referenced_table.get_chunk(pos_list.single_chunk_id());
+      if (!_can_prune(referenced_chunk)) {
+        _scan_data_segment(*referenced_chunk.get_segment(referenced_column_id), begin, end, matches);
+      }
+      return;
+    }
+
+    if (const auto& selection = pos_list.selection()) {
+      // dense selections are not scanned here, but intersected with the matches of the referenced segment
+      const auto& selection_vector = selection->selection_vector();
+      const auto offset_at = [&](const size_t index) { return selection_vector[begin + index]; };
+      _scan_referenced_group(referenced_table.get_chunk(pos_list.single_chunk_id()), referenced_column_id,
+                             end - begin, offset_at, begin, matches);
+      return;
+    }
+
+    const auto& row_ids = pos_list.row_ids();
+    if (pos_list.benefits_from_grouping(begin, end)) {
+      const auto groups = pos_list.group_by_chunk(begin, end);
+      const auto first_match = matches.size();
+      auto group_matches = std::vector<ChunkOffset>{};
+      for (auto group_id = size_t{0}; group_id < groups.chunk_ids.size(); ++group_id) {
+        const auto* indices = groups.indices.data() + groups.group_begins[group_id];
+        const auto group_size = groups.group_begins[group_id + 1] - groups.group_begins[group_id];
+        const auto offset_at = [&](const size_t index) { return row_ids[indices[index]].chunk_offset; };
+
+        group_matches.clear();
+        _scan_referenced_group(referenced_table.get_chunk(groups.chunk_ids[group_id]), referenced_column_id,
+                               group_size, offset_at, ChunkOffset{0}, group_matches);
+        for (const auto index : group_matches) matches.push_back(indices[index]);
+      }
+      std::sort(matches.begin() + first_match, matches.end());
+      return;
+    }
+
+    auto group_begin = size_t{begin};
+    while (group_begin < end) {
+      const auto chunk_id = row_ids[group_begin].chunk_id;
+      auto group_end = pos_list.references_single_chunk() ? size_t{end} : group_begin + 1;
+      while (group_end < end && row_ids[group_end].chunk_id == chunk_id) ++group_end;
+
+      const auto offset_at = [&](const size_t index) { return row_ids[group_begin + index].chunk_offset; };
+      _scan_referenced_group(referenced_table.get_chunk(chunk_id), referenced_column_id, group_end - group_begin,
+                             offset_at, static_cast<ChunkOffset>(group_begin), matches);
+
+      group_begin = group_end;
+    }
+  }
+
+  // appends base + index to matches for each index in [0, group_size) for which the value at offset_at(index) in the
+  // referenced chunk matches
+  template <typename OffsetAt>
+  void _scan_referenced_group(const Chunk& referenced_chunk, const ColumnID referenced_column_id,
+                              const size_t group_size, const OffsetAt& offset_at, const ChunkOffset base,
+                              std::vector<ChunkOffset>& matches) const {
+    if (_can_prune(referenced_chunk)) return;
+
+    const auto referenced_segment = referenced_chunk.get_segment(referenced_column_id);
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(referenced_segment.get())) {
+      _scan_dictionary_segment(*dictionary_segment, group_size, offset_at, base, matches);
+      return;
+    }
+
+    with_comparator(_scan_type, [&](const auto& comparator) {
+      detail::with_point_accessor<T>(*referenced_segment, group_size, [&](const auto& accessor) {
+        for (auto index = size_t{0}; index < group_size; ++index) {
+          if (comparator(accessor(offset_at(index)), _search_value)) {
+            matches.push_back(static_cast<ChunkOffset>(base + index));
+          }
+        }
+      });
+    });
+  }
+
+  // Creates a chunk of ReferenceSegments for the matching rows of an input chunk. If the input chunk consists of
+  // ReferenceSegments, the output references the same data segments. Columns that share a position list in the input
+  // share the filtered position list in the output, unless filtered_pos_lists already holds one for it.
+  //
+  // Rows of a single chunk are referenced by a ChunkSelection instead of RowIDs. If all rows match, the positions are
+  // not materialized at all: The output either references the entire input chunk or reuses the position lists of the
+  // input.
+  Chunk _output_chunk(const Chunk& input_chunk, const ChunkID chunk_id,
+                      const std::vector<ChunkOffset>& matching_offsets, PosListMapping filtered_pos_lists = {}) const {
+    auto output_chunk = Chunk{};
+    const auto all_rows_match = matching_offsets.size() == input_chunk.size() && input_chunk.size() > 0;
+    auto data_pos_list = std::shared_ptr<PosList>{};
+
+    for (auto column_id = ColumnID{0}; column_id < _input_table->column_count(); ++column_id) {
+      const auto segment = input_chunk.get_segment(column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+
+      if (!reference_segment) {
+        if (!data_pos_list && all_rows_match) {
+          data_pos_list = PosList::entire_chunk(chunk_id, input_chunk.size());
+        } else if (!data_pos_list) {
+          data_pos_list = PosList::chunk_selection(
+              chunk_id, std::make_shared<const ChunkSelection>(input_chunk.size(), matching_offsets));
+        }
+        output_chunk.add_segment(std::make_shared<ReferenceSegment>(_input_table, column_id, data_pos_list));
+        continue;
+      }
+
+      const auto& input_pos_list = reference_segment->pos_list();
+      auto& filtered_pos_list = filtered_pos_lists[input_pos_list];
+      if (!filtered_pos_list && all_rows_match) {
+        filtered_pos_list = input_pos_list;
+      } else if (!filtered_pos_list && !input_pos_list->is_materialized()) {
+        const auto referenced_chunk_id = input_pos_list->single_chunk_id();
+        const auto& referenced_chunk = reference_segment->referenced_table()->get_chunk(referenced_chunk_id);
+        filtered_pos_list = PosList::chunk_selection(
+            referenced_chunk_id, std::make_shared<const ChunkSelection>(
+                                     referenced_chunk.size(), _selected_offsets(*input_pos_list, matching_offsets)));
+      } else if (!filtered_pos_list) {
+        auto pos_list = std::make_shared<PosList>();
+        pos_list->reserve(matching_offsets.size());
+        const auto& row_ids = input_pos_list->row_ids();
+        for (const auto chunk_offset : matching_offsets) pos_list->push_back(row_ids[chunk_offset]);
+        filtered_pos_list = std::move(pos_list);
+      }
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+          reference_segment->referenced_table(), reference_segment->referenced_column_id(), filtered_pos_list));
+    }
+
+    return output_chunk;
+  }
+
+  // returns the offsets within the referenced chunk of the positions at the given (sorted) indices of a list that
+  // references a single chunk without materialized RowIDs
+  static std::vector<ChunkOffset> _selected_offsets(const PosList& pos_list, const std::vector<ChunkOffset>& indices) {
+    if (pos_list.is_entire_chunk()) return indices;
+
+    const auto& selection = *pos_list.selection();
+    auto offsets = std::vector<ChunkOffset>{};
+    offsets.reserve(indices.size());
+    if (!selection.is_bitmap()) {
+      const auto& selection_vector = selection.selection_vector();
+      for (const auto index : indices) offsets.push_back(selection_vector[index]);
+      return offsets;
+    }
+
+    // walk the bitmap once instead of searching it for each index
+    auto index = ChunkOffset{0};
+    auto indices_it = indices.cbegin();
+    selection.for_each([&](const ChunkOffset chunk_offset) {
+      if (indices_it != indices.cend() && *indices_it == index++) {
+        offsets.push_back(chunk_offset);
+        ++indices_it;
+      }
+    });
+    return offsets;
+  }
+
+  const std::shared_ptr<const Table> _input_table;
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value_variant;
+  const T _search_value;
+};
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : AbstractStreamingOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+TableScan::~TableScan() = default;
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto impl = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(
+      input_table->column_type(_column_id), input_table, _column_id, _scan_type, _search_value);
+  return impl->on_execute();
+}
+
+std::optional<Chunk> TableScan::process_chunk(const std::shared_ptr<const Table>& input_table, const Chunk& chunk,
+                                              const ChunkID chunk_id) const {
+  const auto impl = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(
+      input_table->column_type(_column_id), input_table, _column_id, _scan_type, _search_value);
+  return impl->scan_chunk(chunk, chunk_id);
+}
+
+}  // namespace opossum
@@ -5,7 +5,7 @@
 #include <string>
 #include <vector>
 
-#include "abstract_operator.hpp"
+#include "abstract_streaming_operator.hpp"
 #include "all_type_variant.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -15,8 +15,22 @@ namespace opossum {
 class BaseTableScanImpl;
 class Table;
 
-class TableScan : public AbstractOperator {
+// Selects the rows of the input table for which "value <scan_type> search_value" holds in the given column. The output
+// consists of ReferenceSegments that point to the data segments of the scanned rows, also if the input table already
+// consists of ReferenceSegments.
+//
+// Chunks whose segment statistics (zone maps) or Bloom filters rule out any match are skipped. On DictionarySegments,
+// the predicate is translated into a range of ValueIDs once, so that only integers are compared while scanning the
+// attribute vector. If all or none of the dictionary entries match, the attribute vector is not read at all.
+//
+// The chunks are split into morsels of MORSEL_SIZE rows, which are scanned as jobs on the TaskScheduler. The output
+// chunks are in the same order as the input chunks, regardless of the order in which the jobs finish. Within a
+// Pipeline, each chunk is scanned as a whole by the job that pushes it through the Pipeline.
+class TableScan : public AbstractStreamingOperator {
  public:
+  // a multiple of FrameOfReferenceSegment::BLOCK_SIZE, so that morsels do not decode blocks twice
+  static constexpr auto MORSEL_SIZE = size_t{65'536};
+
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
             const AllTypeVariant search_value);
 
@@ -26,8 +40,15 @@ class TableScan : public AbstractOperator {
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
 
+  std::optional<Chunk> process_chunk(const std::shared_ptr<const Table>& input_table, const Chunk& chunk,
+                                     const ChunkID chunk_id) const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
 };
 
 }  // namespace opossum
@@ -0,0 +1,153 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "sort_column.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t k)
+    : AbstractOperator(in), _sort_definitions(sort_definitions), _k(k) {}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+size_t TopK::k() const { return _k; }
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+  Assert(!_sort_definitions.empty(), "TopK needs a sort column");
+
+  auto sort_columns = std::vector<std::unique_ptr<BaseSortColumn>>{};
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column_id < input_table->column_count(), "Column does not exist");
+    sort_columns.emplace_back(make_unique_by_data_type<BaseSortColumn, SortColumn>(
+        input_table->column_type(sort_definition.column_id), chunk_count, sort_definition.order_by_mode));
+  }
+
+  // The candidates of a chunk are its best rows, whose values the sort columns hold at the same index
+  auto candidate_offsets = std::vector<std::vector<ChunkOffset>>(chunk_count);
+
+  // Returns whether a row precedes another one. Rows are identified by their chunk and index, and equal rows are
+  // ordered by their position, as in Sort.
+  using Row = std::pair<ChunkID, size_t>;
+  const auto precedes = [&](const Row& lhs, const Row& rhs, const auto& offset_of) {
+    for (const auto& sort_column : sort_columns) {
+      const auto result = sort_column->compare(lhs.first, lhs.second, rhs.first, rhs.second);
+      if (result != 0) return result < 0;
+    }
+    return RowID{lhs.first, offset_of(lhs)} < RowID{rhs.first, offset_of(rhs)};
+  };
+  const auto candidate_offset = [&](const Row& row) { return candidate_offsets[row.first][row.second]; };
+
+  // the k best rows so far, with the last of them on top
+  const auto candidate_precedes = [&](const Row& lhs, const Row& rhs) { return precedes(lhs, rhs, candidate_offset); };
+  auto top_rows = std::priority_queue<Row, std::vector<Row>, decltype(candidate_precedes)>{candidate_precedes};
+
+  // visit the chunks whose first sort column can hold the best values first, chunks without statistics can hold any
+  const auto first_column_id = _sort_definitions.front().column_id;
+  const auto descending = _sort_definitions.front().order_by_mode == OrderByMode::Descending;
+  auto chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (input_table->get_chunk(chunk_id).size() > 0) chunk_ids.push_back(chunk_id);
+  }
+  resolve_data_type(input_table->column_type(first_column_id), [&](auto data_type) {
+    using Type = typename decltype(data_type)::type;
+    const auto statistics = [&](const ChunkID chunk_id) {
+      return std::dynamic_pointer_cast<const SegmentStatistics<Type>>(
+          input_table->get_chunk(chunk_id).get_segment_statistics(first_column_id));
+    };
+    std::stable_sort(chunk_ids.begin(), chunk_ids.end(), [&](const ChunkID lhs, const ChunkID rhs) {
+      const auto lhs_statistics = statistics(lhs);
+      const auto rhs_statistics = statistics(rhs);
+      if (!lhs_statistics || !rhs_statistics) return !lhs_statistics && rhs_statistics;
+      return descending ? rhs_statistics->max() < lhs_statistics->max() : lhs_statistics->min() < rhs_statistics->min();
+    });
+  });
+
+  const auto wave_size = TaskScheduler::get().worker_count();
+  auto next_chunk = size_t{0};
+  while (_k > 0 && next_chunk < chunk_ids.size()) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    auto wave_chunk_ids = std::vector<ChunkID>{};
+    for (; next_chunk < chunk_ids.size() && wave_chunk_ids.size() < wave_size; ++next_chunk) {
+      const auto chunk_id = chunk_ids[next_chunk];
+      const auto& chunk = input_table->get_chunk(chunk_id);
+
+      const auto statistics = chunk.get_segment_statistics(first_column_id);
+      if (statistics && top_rows.size() == _k &&
+          sort_columns.front()->comes_after(*statistics, top_rows.top().first, top_rows.top().second)) {
+        continue;
+      }
+
+      wave_chunk_ids.push_back(chunk_id);
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        for (auto index = size_t{0}; index < sort_columns.size(); ++index) {
+          sort_columns[index]->materialize(chunk_id, *chunk.get_segment(_sort_definitions[index].column_id));
+        }
+
+        // before the values are reordered, the index of a row is its offset
+        const auto chunk_precedes = [&](const Row& lhs, const Row& rhs) {
+          return precedes(lhs, rhs, [](const Row& row) { return static_cast<ChunkOffset>(row.second); });
+        };
+        auto chunk_top_rows = std::priority_queue<Row, std::vector<Row>, decltype(chunk_precedes)>{chunk_precedes};
+        for (auto chunk_offset = size_t{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+          const auto row = Row{chunk_id, chunk_offset};
+          if (chunk_top_rows.size() < _k) {
+            chunk_top_rows.push(row);
+          } else if (chunk_precedes(row, chunk_top_rows.top())) {
+            chunk_top_rows.pop();
+            chunk_top_rows.push(row);
+          }
+        }
+
+        auto& offsets = candidate_offsets[chunk_id];
+        for (; !chunk_top_rows.empty(); chunk_top_rows.pop()) {
+          offsets.push_back(static_cast<ChunkOffset>(chunk_top_rows.top().second));
+        }
+        std::reverse(offsets.begin(), offsets.end());
+        for (auto& sort_column : sort_columns) sort_column->reorder(chunk_id, offsets);
+      }));
+    }
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+    for (const auto& chunk_id : wave_chunk_ids) {
+      for (auto index = size_t{0}; index < candidate_offsets[chunk_id].size(); ++index) {
+        const auto row = Row{chunk_id, index};
+        if (top_rows.size() < _k) {
+          top_rows.push(row);
+        } else if (candidate_precedes(row, top_rows.top())) {
+          top_rows.pop();
+          top_rows.push(row);
+        }
+      }
+    }
+  }
+
+  auto row_ids = std::vector<RowID>(top_rows.size());
+  for (auto index = row_ids.size(); index > 0; --index, top_rows.pop()) {
+    row_ids[index - 1] = RowID{top_rows.top().first, candidate_offset(top_rows.top())};
+  }
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  auto output_chunk = Chunk{};
+  _add_reference_segments(output_chunk, input_table, std::make_shared<PosList>(std::move(row_ids)));
+  output_table->emplace_chunk(std::move(output_chunk));
+  return output_table;
+}
+
+}  // namespace opossum
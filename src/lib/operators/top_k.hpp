@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Returns the first k rows of the input in the order that Sort would produce, without sorting the whole input, e.g.,
+// for "ORDER BY a LIMIT k". The output is a single chunk of ReferenceSegments.
+//
+// The chunks are processed by jobs on the TaskScheduler in waves of one chunk per worker. Each job keeps the k best
+// rows of its chunk in a bounded heap, and after each wave, these candidates are merged into the k best rows so far.
+// Chunks are visited in the order of the minimum (or, if descending, maximum) of the first sort column in their segment
+// statistics. Once k rows are found, chunks whose statistics show that none of their rows can precede the k-th row are
+// skipped.
+class TopK : public AbstractOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t k);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  size_t k() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const size_t _k;
+};
+
+}  // namespace opossum
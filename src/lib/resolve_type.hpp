@@ -7,11 +7,18 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -129,4 +136,70 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+/**
+ * Resolves the concrete type of a segment whose data type is known by passing the segment, cast to that type, on to
+ * a generic lambda. This way, typed code for all segment types is generated and the type is only checked once per
+ * segment instead of once per value.
+ *
+ * @param segment is a segment of data type T, i.e., a ValueSegment<T>, DictionarySegment<T>, RunLengthSegment<T>,
+ *        FrameOfReferenceSegment<T> (only for int and long), or a ReferenceSegment
+ * @param func is a generic lambda or similar accepting a const reference to any of these segment types
+ *
+ *
+ * Example:
+ *
+ *   resolve_data_type(table->column_type(column_id), [&](auto type) {
+ *     using Type = typename decltype(type)::type;
+ *
+ *     resolve_segment_type<Type>(*segment, [&](const auto& typed_segment) {
+ *       using SegmentType = std::decay_t<decltype(typed_segment)>;
+ *       if constexpr (std::is_same_v<SegmentType, ValueSegment<Type>>) {
+ *         const auto& values = typed_segment.values();
+ *         ...
+ *       }
+ *     });
+ *   });
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const BaseSegment& segment, const Functor& func) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    func(*value_segment);
+  } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    func(*dictionary_segment);
+  } else if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    func(*reference_segment);
+  } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    func(*run_length_segment);
+  } else {
+    // FrameOfReferenceSegment cannot even be instantiated for other types
+    if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+      if (const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+        func(*frame_of_reference_segment);
+        return;
+      }
+    }
+    Fail("Unrecognized segment type");
+  }
+}
+
+/**
+ * Resolves the concrete type of an attribute vector, i.e., a FixedSizeAttributeVector of any width or a
+ * BitPackedAttributeVector, and passes it on to a generic lambda. As these classes are final, calls to get() on the
+ * resolved vector are not virtual and can be inlined.
+ */
+template <typename Functor>
+void resolve_attribute_vector_type(const BaseAttributeVector& attribute_vector, const Functor& func) {
+  if (const auto fixed_size_8 = dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(&attribute_vector)) {
+    func(*fixed_size_8);
+  } else if (const auto fixed_size_16 = dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(&attribute_vector)) {
+    func(*fixed_size_16);
+  } else if (const auto fixed_size_32 = dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(&attribute_vector)) {
+    func(*fixed_size_32);
+  } else if (const auto bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    func(*bit_packed);
+  } else {
+    Fail("Unrecognized attribute vector type");
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,74 @@
+#include "abstract_task.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "task_group.hpp"
+#include "task_scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  DebugAssert(!_is_scheduled && !successor->_is_scheduled, "Dependencies have to be set up before scheduling");
+
+  _successors.push_back(successor);
+  ++successor->_pending_predecessor_count;
+}
+
+void AbstractTask::set_group(const std::shared_ptr<TaskGroup>& group) {
+  DebugAssert(!_is_scheduled, "The group has to be set before scheduling");
+  _group = group;
+}
+
+const std::shared_ptr<TaskGroup>& AbstractTask::group() const { return _group; }
+
+bool AbstractTask::is_ready() const { return _pending_predecessor_count == 0; }
+
+bool AbstractTask::is_done() const { return _is_done; }
+
+void AbstractTask::schedule() {
+  DebugAssert(!_is_scheduled, "Tasks shall not be scheduled twice");
+
+  if (!_group) _group = TaskGroup::current();
+  _is_scheduled = true;
+  _try_enqueue();
+}
+
+void AbstractTask::join() { TaskScheduler::get().wait_for_tasks({shared_from_this()}); }
+
+void AbstractTask::execute() {
+  DebugAssert(!_is_done, "Tasks shall not be executed twice");
+
+  // the TaskScheduler counted the task as active in its group when it took it from a queue
+  const auto previous_group = TaskGroup::current();
+  TaskGroup::_set_current(_group);
+  try {
+    _on_execute();
+  } catch (...) {
+    _exception = std::current_exception();
+  }
+  TaskGroup::_set_current(previous_group);
+  if (_group) _group->_release();
+  _is_done = true;
+
+  for (const auto& successor : _successors) {
+    if (--successor->_pending_predecessor_count == 0) {
+      successor->_try_enqueue();
+    }
+  }
+  _successors.clear();
+
+  TaskScheduler::get()._notify_finished(_group != nullptr);
+}
+
+void AbstractTask::_try_enqueue() {
+  // Both schedule() and the last finishing predecessor call this method. Whoever sees both conditions fulfilled first
+  // enqueues the task.
+  if (!_is_scheduled || !is_ready()) return;
+  if (_is_enqueued.exchange(true)) return;
+
+  TaskScheduler::get()._enqueue(shared_from_this());
+}
+
+}  // namespace opossum
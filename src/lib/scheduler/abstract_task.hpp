@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class TaskGroup;
+class TaskScheduler;
+
+// AbstractTask is the abstract super class for all units of work that are executed by the TaskScheduler, e.g.,
+// JobTask. Tasks can depend on other tasks: A task is only executed once all its predecessors are done.
+//
+// The lifecycle of a task is:
+// 1. The task is created and its dependencies (and, optionally, its TaskGroup) are set up.
+// 2. schedule() hands the task to the TaskScheduler, which executes it on a worker as soon as it is ready.
+// 3. join() (or TaskScheduler::wait_for_tasks) blocks until the task is done. If the task threw an exception, it is
+//    rethrown there.
+//
+// Tasks shall not be scheduled twice.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  virtual ~AbstractTask() = default;
+
+  // Makes this task a predecessor of the given task, i.e., successor is not executed before this task is done.
+  // Has to be called before either of the tasks is scheduled.
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  // Adds the task to a group that limits how many of its tasks are executed concurrently. Has to be called before the
+  // task is scheduled. Otherwise, the task joins the group of the task that schedules it, if any.
+  void set_group(const std::shared_ptr<TaskGroup>& group);
+  const std::shared_ptr<TaskGroup>& group() const;
+
+  // returns whether all predecessors are done
+  bool is_ready() const;
+
+  // returns whether the task has been executed
+  bool is_done() const;
+
+  // hands the task to the TaskScheduler, which executes it as soon as it is ready
+  void schedule();
+
+  // Blocks until the task is done and rethrows its exception, if any. While waiting, the calling thread executes
+  // other pending tasks, so joining from within a task does not block a worker.
+  void join();
+
+  // Executes the task on the calling thread and releases its successors. This is called by the TaskScheduler.
+  void execute();
+
+ protected:
+  AbstractTask() = default;
+
+  // abstract method that does the actual work
+  virtual void _on_execute() = 0;
+
+ private:
+  friend class TaskScheduler;
+
+  // enqueues the task into the TaskScheduler if it is scheduled and ready, and has not been enqueued before
+  void _try_enqueue();
+
+  std::atomic<uint32_t> _pending_predecessor_count{0};
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+
+  std::shared_ptr<TaskGroup> _group;
+
+  std::atomic_bool _is_scheduled{false};
+  std::atomic_bool _is_enqueued{false};
+  std::atomic_bool _is_done{false};
+
+  // set if _on_execute threw, rethrown by join()
+  std::exception_ptr _exception;
+};
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <functional>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+// JobTask executes an arbitrary function. It is the building block for parallelizing operators and storage
+// operations, e.g., one job per column or per chunk:
+//
+//   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+//   for (...) jobs.emplace_back(std::make_shared<JobTask>([&]() { ... }));
+//   TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+class JobTask : public AbstractTask {
+ public:
+  explicit JobTask(const std::function<void()>& function);
+
+ protected:
+  void _on_execute() override;
+
+  const std::function<void()> _function;
+};
+
+}  // namespace opossum
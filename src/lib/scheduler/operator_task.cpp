@@ -0,0 +1,61 @@
+#include "operator_task.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "task_group.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+using TasksByOperator = std::unordered_map<const AbstractOperator*, std::shared_ptr<OperatorTask>>;
+
+// returns the task of the operator, which is created after those of its inputs, or nullptr if it was executed already
+std::shared_ptr<OperatorTask> add_tasks(const std::shared_ptr<const AbstractOperator>& op,
+                                        TasksByOperator& tasks_by_operator,
+                                        std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  if (!op || op->get_output()) return nullptr;
+
+  const auto task_it = tasks_by_operator.find(op.get());
+  if (task_it != tasks_by_operator.end()) return task_it->second;
+
+  // Operators only get const access to their inputs, as they must not execute them. The task is the one that does.
+  const auto task = std::make_shared<OperatorTask>(std::const_pointer_cast<AbstractOperator>(op));
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (const auto input_task = add_tasks(input, tasks_by_operator, tasks)) input_task->set_as_predecessor_of(task);
+  }
+  tasks_by_operator.emplace(op.get(), task);
+  tasks.push_back(task);
+  return task;
+}
+
+}  // namespace
+
+OperatorTask::OperatorTask(const std::shared_ptr<AbstractOperator>& op) : _operator(op) {}
+
+std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator>& op, const std::shared_ptr<TaskGroup>& group) {
+  auto tasks_by_operator = TasksByOperator{};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  add_tasks(op, tasks_by_operator, tasks);
+
+  if (group) {
+    for (const auto& task : tasks) task->set_group(group);
+  }
+  return tasks;
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _operator; }
+
+void OperatorTask::_on_execute() {
+  for (const auto& input : {_operator->input_left(), _operator->input_right()}) {
+    Assert(!input || input->get_output(), "An input of the operator was not executed");
+  }
+  _operator->execute();
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class TaskGroup;
+
+// OperatorTask executes an operator. make_tasks_from_operator turns a query plan, i.e., a tree of operators whose
+// subtrees may be shared, into a graph of tasks whose dependencies are the inputs of the operators. Each operator is
+// thus executed as soon as its inputs are done, and independent subtrees, e.g., both inputs of a join, are executed
+// concurrently. The jobs that the operators split their work into, e.g., the morsels of a TableScan, are queued on the
+// worker that executes the operator and stolen by idle workers.
+//
+//   auto tasks = OperatorTask::make_tasks_from_operator(root, std::make_shared<TaskGroup>(4));
+//   TaskScheduler::get().schedule_and_wait_for_tasks(tasks);
+//   const auto result = root->get_output();
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(const std::shared_ptr<AbstractOperator>& op);
+
+  // Creates a task for the given operator and for each operator below it that has not been executed yet. Each task
+  // comes after its predecessors, so the task of the given operator is the last one. If a group is given, all tasks
+  // (and the jobs that they schedule) belong to it, which limits the concurrency of the query.
+  static std::vector<std::shared_ptr<AbstractTask>> make_tasks_from_operator(
+      const std::shared_ptr<AbstractOperator>& op, const std::shared_ptr<TaskGroup>& group = nullptr);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  // fails if an input has no output, e.g., because its task threw an exception
+  void _on_execute() override;
+
+  const std::shared_ptr<AbstractOperator> _operator;
+};
+
+}  // namespace opossum
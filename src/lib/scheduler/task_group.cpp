@@ -0,0 +1,73 @@
+#include "task_group.hpp"
+
+#include <memory>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// group of the task that is executed on the current thread
+thread_local auto current_group = std::shared_ptr<TaskGroup>{};
+
+}  // namespace
+
+TaskGroup::TaskGroup(const size_t max_concurrency) : _max_concurrency(max_concurrency) {
+  Assert(max_concurrency > 0, "A task group has to allow at least one task");
+}
+
+std::shared_ptr<TaskGroup> TaskGroup::current() { return current_group; }
+
+size_t TaskGroup::max_concurrency() const { return _max_concurrency; }
+
+size_t TaskGroup::active_task_count() const { return _active_task_count; }
+
+void TaskGroup::_set_current(const std::shared_ptr<TaskGroup>& group) { current_group = group; }
+
+bool TaskGroup::_push(const std::shared_ptr<AbstractTask>& task) {
+  const std::lock_guard<std::mutex> lock(_mutex);
+  _tasks.push_back(task);
+  if (_is_registered) return false;
+
+  _is_registered = true;
+  return true;
+}
+
+std::shared_ptr<AbstractTask> TaskGroup::_try_pop(const bool newest) {
+  const std::lock_guard<std::mutex> lock(_mutex);
+  if (_tasks.empty() || !_try_acquire()) return nullptr;
+
+  auto task = std::shared_ptr<AbstractTask>{};
+  if (newest) {
+    task = std::move(_tasks.back());
+    _tasks.pop_back();
+  } else {
+    task = std::move(_tasks.front());
+    _tasks.pop_front();
+  }
+  return task;
+}
+
+bool TaskGroup::_try_unregister() {
+  const std::lock_guard<std::mutex> lock(_mutex);
+  if (!_tasks.empty()) return false;
+
+  _is_registered = false;
+  return true;
+}
+
+bool TaskGroup::_try_acquire() {
+  auto active_task_count = _active_task_count.load();
+  while (active_task_count < _max_concurrency) {
+    if (_active_task_count.compare_exchange_weak(active_task_count, active_task_count + 1)) return true;
+  }
+  return false;
+}
+
+void TaskGroup::_acquire() { ++_active_task_count; }
+
+void TaskGroup::_release() { --_active_task_count; }
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// TaskGroup limits how many of its tasks are executed concurrently, e.g., for the tasks of a query, so that concurrent
+// queries share the workers instead of each one assuming that it owns all of them. Tasks that are scheduled while a
+// task of the group is executed, e.g., the jobs of an operator, join the group as well.
+//
+// A task that waits for other tasks (see TaskScheduler::wait_for_tasks) does not count against the limit while it
+// waits. Thus, the tasks that it waits for can always be executed, even if the limit is one.
+//
+// The ready tasks of a group are queued in the group itself rather than in the queues of the TaskScheduler's workers.
+// The group only hands out a task while the limit allows another active one, so the tasks of a group that is at its
+// limit are not looked at when the workers search for a task.
+class TaskGroup : private Noncopyable {
+ public:
+  explicit TaskGroup(const size_t max_concurrency);
+
+  // returns the group of the task that is executed on the calling thread, or nullptr
+  static std::shared_ptr<TaskGroup> current();
+
+  size_t max_concurrency() const;
+
+  // returns the number of tasks of the group that are executed and not waiting
+  size_t active_task_count() const;
+
+ private:
+  friend class AbstractTask;
+  friend class TaskScheduler;
+
+  static void _set_current(const std::shared_ptr<TaskGroup>& group);
+
+  // Adds a ready task of the group. Returns whether the group has to be registered with the TaskScheduler, as it had no
+  // queued task before.
+  bool _push(const std::shared_ptr<AbstractTask>& task);
+
+  // Takes the newest or the oldest queued task and counts it as active if fewer than max_concurrency tasks are active.
+  // Returns nullptr otherwise.
+  std::shared_ptr<AbstractTask> _try_pop(const bool newest);
+
+  // marks the group as unregistered if it has no queued task, returns whether it did
+  bool _try_unregister();
+
+  // counts a task as active if fewer than max_concurrency ones are, returns whether it did
+  bool _try_acquire();
+
+  // counts a task as active again after it waited, even if this exceeds the limit
+  void _acquire();
+
+  void _release();
+
+  const size_t _max_concurrency;
+  std::atomic<size_t> _active_task_count{0};
+
+  std::mutex _mutex;
+  std::deque<std::shared_ptr<AbstractTask>> _tasks;
+  bool _is_registered{false};
+};
+
+}  // namespace opossum
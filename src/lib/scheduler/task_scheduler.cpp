@@ -0,0 +1,235 @@
+#include "task_scheduler.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_group.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto NO_WORKER = std::numeric_limits<size_t>::max();
+
+// id of the worker that runs on the current thread, NO_WORKER for all other threads
+thread_local auto current_worker_id = NO_WORKER;
+
+}  // namespace
+
+TaskScheduler& TaskScheduler::get() {
+  static TaskScheduler instance;
+  return instance;
+}
+
+TaskScheduler::TaskScheduler() {
+  const auto worker_count = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _queues.emplace_back(std::make_unique<TaskQueue>());
+  }
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _workers.emplace_back(&TaskScheduler::_work, this, worker_id);
+  }
+}
+
+TaskScheduler::~TaskScheduler() {
+  {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown = true;
+  }
+  _worker_condition.notify_all();
+
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+size_t TaskScheduler::worker_count() const { return _workers.size(); }
+
+void TaskScheduler::wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  const auto queue_id = current_worker_id == NO_WORKER ? size_t{0} : current_worker_id;
+
+  // the waiting task leaves room in its group for the tasks that it waits for
+  const auto group = TaskGroup::current();
+  if (group) {
+    group->_release();
+    _notify_finished(true);
+  }
+
+  // the groups whose tasks the waiting thread may execute
+  auto groups = std::vector<std::shared_ptr<TaskGroup>>{};
+  if (group) groups.push_back(group);
+  for (const auto& task : tasks) {
+    if (task->_group && std::find(groups.cbegin(), groups.cend(), task->_group) == groups.cend()) {
+      groups.push_back(task->_group);
+    }
+  }
+
+  for (const auto& task : tasks) {
+    while (!task->is_done()) {
+      // Help instead of idling. This is what prevents nested waits from deadlocking the pool.
+      const auto notification_count = _notification_count.load();
+      if (const auto pending_task = _pop_task(queue_id, groups)) {
+        pending_task->execute();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(_mutex);
+      _waiter_condition.wait(lock, [&]() { return task->is_done() || _notification_count != notification_count; });
+    }
+  }
+
+  if (group) group->_acquire();
+
+  for (const auto& task : tasks) {
+    if (task->_exception) std::rethrow_exception(task->_exception);
+  }
+}
+
+void TaskScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+  wait_for_tasks(tasks);
+}
+
+void TaskScheduler::_enqueue(const std::shared_ptr<AbstractTask>& task) {
+  if (task->_group) {
+    if (task->_group->_push(task)) {
+      const std::lock_guard<std::mutex> lock(_groups_mutex);
+      _groups.push_back(task->_group);
+    }
+  } else {
+    // Workers keep the tasks they create, other threads distribute them round-robin
+    const auto queue_id =
+        current_worker_id != NO_WORKER ? current_worker_id : _next_queue_id++ % _queues.size();
+
+    auto& queue = *_queues[queue_id];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(task);
+  }
+  ++_queued_task_count;
+
+  _notify_enqueued();
+}
+
+std::shared_ptr<AbstractTask> TaskScheduler::_pop_task(const size_t queue_id) {
+  if (_queued_task_count == 0) return nullptr;
+  if (auto task = _pop_ungrouped_task(queue_id)) return task;
+
+  const std::lock_guard<std::mutex> lock(_groups_mutex);
+  for (auto index = size_t{0}; index < _groups.size();) {
+    if (auto task = _groups[index]->_try_pop(false)) {
+      --_queued_task_count;
+      return task;
+    }
+
+    // groups without queued tasks are removed, groups at their limit are skipped
+    if (_groups[index]->_try_unregister()) {
+      std::swap(_groups[index], _groups.back());
+      _groups.pop_back();
+    } else {
+      ++index;
+    }
+  }
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> TaskScheduler::_pop_task(const size_t queue_id,
+                                                       const std::vector<std::shared_ptr<TaskGroup>>& groups) {
+  if (_queued_task_count == 0) return nullptr;
+  if (auto task = _pop_ungrouped_task(queue_id)) return task;
+
+  for (const auto& group : groups) {
+    if (auto task = group->_try_pop(true)) {
+      --_queued_task_count;
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> TaskScheduler::_pop_ungrouped_task(const size_t queue_id) {
+  {
+    auto& queue = *_queues[queue_id];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      auto task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      --_queued_task_count;
+      return task;
+    }
+  }
+
+  for (auto offset = size_t{1}; offset < _queues.size(); ++offset) {
+    auto& queue = *_queues[(queue_id + offset) % _queues.size()];
+    const std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      auto task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      --_queued_task_count;
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+void TaskScheduler::_notify_enqueued() {
+  // Changing the count under the mutex ensures that no thread is between checking its wait condition and going to sleep
+  auto has_idle_worker = false;
+  {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    ++_notification_count;
+    has_idle_worker = _idle_worker_count > 0;
+  }
+
+  // Each worker can execute the task. If all of them are busy, they might be waiting for it themselves.
+  if (has_idle_worker) {
+    _worker_condition.notify_one();
+  } else {
+    _waiter_condition.notify_all();
+  }
+}
+
+void TaskScheduler::_notify_finished(const bool released_group_slot) {
+  {
+    const std::lock_guard<std::mutex> lock(_mutex);
+    ++_notification_count;
+  }
+
+  _waiter_condition.notify_all();
+  if (released_group_slot) _worker_condition.notify_one();
+}
+
+void TaskScheduler::_work(const size_t worker_id) {
+  current_worker_id = worker_id;
+
+  while (true) {
+    const auto notification_count = _notification_count.load();
+    if (const auto task = _pop_task(worker_id)) {
+      task->execute();
+      continue;
+    }
+
+    // on shutdown, the workers exit once all queued tasks are executed
+    const auto is_drained = [&]() { return _shutdown && _queued_task_count == 0; };
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    ++_idle_worker_count;
+    _worker_condition.wait(lock, [&]() { return is_drained() || _notification_count != notification_count; });
+    --_idle_worker_count;
+    if (is_drained()) {
+      // the other workers might sleep while this one executed the last task
+      lock.unlock();
+      _worker_condition.notify_all();
+      return;
+    }
+  }
+}
+
+}  // namespace opossum
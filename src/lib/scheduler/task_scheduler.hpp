@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class TaskGroup;
+
+// The TaskScheduler is a singleton that executes tasks on a fixed pool of worker threads, one per core. It replaces
+// spawning short-lived threads for each parallel operation, which does not bound concurrency and is expensive for many
+// small jobs.
+//
+// Each worker owns a deque of ready tasks. Tasks that are enqueued from within a worker go to its own deque and are
+// taken from the back (LIFO), which keeps recently produced data in the cache. Idle workers steal from the front of
+// the other workers' deques.
+//
+// Threads that wait for tasks (wait_for_tasks, AbstractTask::join) execute pending tasks in the meantime. Thus, tasks
+// can schedule and wait for nested tasks without blocking a worker or deadlocking the pool. A waiting thread only
+// executes tasks without a group and tasks of its own group or of the groups of the tasks it waits for, so that a
+// query does not execute the long-running tasks of other queries while it waits.
+//
+// The tasks of a TaskGroup are queued in the group, which is registered with the scheduler while it has queued tasks.
+// Once the queues of the workers are empty, the workers take tasks from the registered groups whose limit is not
+// reached.
+//
+// The destructor lets the workers execute all queued tasks before they exit.
+class TaskScheduler : private Noncopyable {
+ public:
+  static TaskScheduler& get();
+
+  ~TaskScheduler();
+
+  // returns the number of worker threads
+  size_t worker_count() const;
+
+  // Blocks until all given tasks are done and rethrows the first exception thrown by one of them. The tasks have to be
+  // scheduled, either before or by another thread.
+  void wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  // schedules all given tasks and waits for them
+  void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  TaskScheduler(TaskScheduler&&) = delete;
+
+ protected:
+  friend class AbstractTask;
+
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<std::shared_ptr<AbstractTask>> tasks;
+  };
+
+  TaskScheduler();
+
+  // adds a ready task to a queue and wakes up a worker
+  void _enqueue(const std::shared_ptr<AbstractTask>& task);
+
+  // Takes a task from the queue of the given worker or, if that has none, steals one from another queue. Otherwise,
+  // takes the oldest task of a registered group that allows another active task. Returns nullptr if there is no task.
+  std::shared_ptr<AbstractTask> _pop_task(const size_t queue_id);
+
+  // Like _pop_task, but only takes tasks of the given groups besides those without a group. Used by waiting threads,
+  // which take the newest task of a group, as that is likely one that they wait for.
+  std::shared_ptr<AbstractTask> _pop_task(const size_t queue_id, const std::vector<std::shared_ptr<TaskGroup>>& groups);
+
+  // takes a task without a group from the queue of the given worker or from another queue
+  std::shared_ptr<AbstractTask> _pop_ungrouped_task(const size_t queue_id);
+
+  // wakes up one idle worker after a task was enqueued, or the waiting threads if no worker is idle
+  void _notify_enqueued();
+
+  // Wakes up the waiting threads after a task finished. If a slot of a group was released, an idle worker is woken up
+  // as well, as a task of the group might be executable now.
+  void _notify_finished(const bool released_group_slot);
+
+  void _work(const size_t worker_id);
+
+  std::vector<std::unique_ptr<TaskQueue>> _queues;
+  std::vector<std::thread> _workers;
+
+  // groups with queued tasks
+  std::mutex _groups_mutex;
+  std::vector<std::shared_ptr<TaskGroup>> _groups;
+
+  std::atomic<size_t> _queued_task_count{0};
+  std::atomic<size_t> _next_queue_id{0};
+
+  // Incremented by each notification. Threads that found no task sleep until it changes, as the tasks that remain
+  // queued might belong to groups that are at their limit.
+  std::atomic<size_t> _notification_count{0};
+
+  // workers and waiting threads sleep on separate conditions, so that an enqueued task wakes up only one worker
+  std::mutex _mutex;
+  std::condition_variable _worker_condition;
+  std::condition_variable _waiter_condition;
+  size_t _idle_worker_count{0};
+  bool _shutdown{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,172 @@
+#include "histogram.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+Histogram<T>::Histogram(std::vector<Bin>&& bins) : _bins(std::move(bins)), _total_count(0), _distinct_count(0) {
+  for (const auto& bin : _bins) {
+    _total_count += bin.height;
+    _distinct_count += bin.distinct_count;
+  }
+}
+
+template <typename T>
+std::shared_ptr<Histogram<T>> Histogram<T>::build(const std::vector<std::pair<T, size_t>>& value_counts,
+                                                  const size_t max_bin_count, const HistogramType type) {
+  Assert(max_bin_count > 0, "A histogram needs at least one bin");
+  DebugAssert(std::is_sorted(value_counts.cbegin(), value_counts.cend(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }),
+              "Values have to be sorted");
+
+  auto bins = std::vector<Bin>{};
+  if (value_counts.empty()) return std::make_shared<Histogram<T>>(std::move(bins));
+
+  auto total_count = size_t{0};
+  for (const auto& value_count : value_counts) total_count += value_count.second;
+
+  // Equi-height: a bin is full once it reaches the target height, the next value starts a new bin
+  const auto target_height = (total_count + max_bin_count - 1) / max_bin_count;
+
+  // Equi-width: the bin of a value follows from its position in the value range
+  const auto equi_width = std::is_arithmetic_v<T> && type == HistogramType::EquiWidth;
+  const auto bin_index = [&](const T& value) {
+    if constexpr (std::is_arithmetic_v<T>) {
+      const auto min = static_cast<double>(value_counts.front().first);
+      const auto range = static_cast<double>(value_counts.back().first) - min;
+      if (range == 0.0) return size_t{0};
+      const auto index = static_cast<size_t>((static_cast<double>(value) - min) / range * max_bin_count);
+      return std::min(index, max_bin_count - 1);
+    } else {
+      return size_t{0};
+    }
+  };
+
+  auto current_bin_index = size_t{0};
+  for (const auto& [value, count] : value_counts) {
+    auto start_new_bin = bins.empty();
+    if (equi_width) {
+      const auto index = bin_index(value);
+      start_new_bin |= index != current_bin_index;
+      current_bin_index = index;
+    } else {
+      start_new_bin |= !bins.empty() && bins.back().height >= target_height;
+    }
+
+    if (start_new_bin) bins.push_back({value, value, 0, 0});
+
+    auto& bin = bins.back();
+    bin.max = value;
+    bin.height += count;
+    ++bin.distinct_count;
+  }
+
+  return std::make_shared<Histogram<T>>(std::move(bins));
+}
+
+template <typename T>
+float Histogram<T>::estimate_cardinality(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  return estimate_cardinality(scan_type, type_cast<T>(search_value));
+}
+
+template <typename T>
+float Histogram<T>::estimate_cardinality(const ScanType scan_type, const T& value) const {
+  const auto total_count = static_cast<float>(_total_count);
+
+  // the estimates of both parts are bounded by the bin of the value, this bounds the complements as well
+  const auto estimate = [&]() {
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return _estimate_equals(value);
+      case ScanType::OpNotEquals:
+        return total_count - _estimate_equals(value);
+      case ScanType::OpLessThan:
+        return _estimate_less_than(value);
+      case ScanType::OpLessThanEquals:
+        return _estimate_less_than(value) + _estimate_equals(value);
+      case ScanType::OpGreaterThan:
+        return total_count - _estimate_less_than(value) - _estimate_equals(value);
+      case ScanType::OpGreaterThanEquals:
+        return total_count - _estimate_less_than(value);
+    }
+    Fail("Unknown scan type");
+  }();
+  return std::clamp(estimate, 0.0f, total_count);
+}
+
+template <typename T>
+float Histogram<T>::_estimate_equals(const T& value) const {
+  // find the first bin whose maximum is not smaller than the value
+  const auto bin_it =
+      std::lower_bound(_bins.cbegin(), _bins.cend(), value, [](const Bin& bin, const T& v) { return bin.max < v; });
+  if (bin_it == _bins.cend() || value < bin_it->min) return 0.0f;
+
+  return static_cast<float>(bin_it->height) / static_cast<float>(bin_it->distinct_count);
+}
+
+template <typename T>
+float Histogram<T>::_estimate_less_than(const T& value) const {
+  auto cardinality = 0.0f;
+  for (const auto& bin : _bins) {
+    if (bin.max < value) {
+      cardinality += static_cast<float>(bin.height);
+      continue;
+    }
+    if (bin.min < value) {
+      // The value lies in the bin, so at least its estimated share of the bin is not smaller than it. Otherwise, the
+      // estimates for "<" and "=" could add up to more than the height of the bin.
+      const auto height = static_cast<float>(bin.height);
+      const auto max_less_than = height - height / static_cast<float>(bin.distinct_count);
+      cardinality += std::min(_share_below(bin, value) * height, max_less_than);
+    }
+    break;
+  }
+  return cardinality;
+}
+
+template <typename T>
+float Histogram<T>::_share_below(const Bin& bin, const T& value) {
+  if constexpr (std::is_integral_v<T>) {
+    // the bin covers the integers min, ..., max
+    return static_cast<float>(static_cast<double>(value) - static_cast<double>(bin.min)) /
+           static_cast<float>(static_cast<double>(bin.max) - static_cast<double>(bin.min) + 1.0);
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<float>((static_cast<double>(value) - bin.min) / (static_cast<double>(bin.max) - bin.min));
+  } else {
+    // Strings cannot be interpolated meaningfully, so half of the bin is assumed
+    return 0.5f;
+  }
+}
+
+template <typename T>
+size_t Histogram<T>::total_count() const {
+  return _total_count;
+}
+
+template <typename T>
+size_t Histogram<T>::distinct_count() const {
+  return _distinct_count;
+}
+
+template <typename T>
+size_t Histogram<T>::bin_count() const {
+  return _bins.size();
+}
+
+template <typename T>
+const std::vector<typename Histogram<T>::Bin>& Histogram<T>::bins() const {
+  return _bins;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(Histogram);
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class HistogramType { EquiHeight, EquiWidth };
+
+// BaseHistogram is the abstract super class of Histogram. A histogram summarizes the value distribution of a column
+// in a fixed number of bins and estimates how many rows satisfy a predicate.
+class BaseHistogram : private Noncopyable {
+ public:
+  virtual ~BaseHistogram() = default;
+
+  // Estimates the number of rows for which "value <scan_type> search_value" holds. The search value is cast to the
+  // data type of the histogram.
+  virtual float estimate_cardinality(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // returns the number of rows that the histogram summarizes
+  virtual size_t total_count() const = 0;
+
+  virtual size_t distinct_count() const = 0;
+
+  virtual size_t bin_count() const = 0;
+};
+
+/**
+ * Histogram<T> divides the distinct values of a column into bins. Each bin stores its smallest and largest value, the
+ * number of rows (height), and the number of distinct values. Within a bin, values are assumed to be distributed
+ * uniformly. A value never spans two bins, so frequent values are estimated well.
+ *
+ * Equi-height histograms close a bin once it holds about total_count / max_bin_count rows, so that dense ranges get
+ * finer bins. Equi-width histograms split the value range into bins of equal width. They can only be built for
+ * arithmetic types; for strings, an equi-height histogram is built instead.
+ */
+template <typename T>
+class Histogram : public BaseHistogram {
+ public:
+  struct Bin {
+    T min;
+    T max;
+    size_t height;
+    size_t distinct_count;
+  };
+
+  explicit Histogram(std::vector<Bin>&& bins);
+
+  // Builds a histogram from the distinct values of a column and their number of occurrences, sorted by value
+  static std::shared_ptr<Histogram<T>> build(const std::vector<std::pair<T, size_t>>& value_counts,
+                                             const size_t max_bin_count,
+                                             const HistogramType type = HistogramType::EquiHeight);
+
+  float estimate_cardinality(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
+  // same as above, but with a typed search value
+  float estimate_cardinality(const ScanType scan_type, const T& value) const;
+
+  size_t total_count() const override;
+  size_t distinct_count() const override;
+  size_t bin_count() const override;
+
+  const std::vector<Bin>& bins() const;
+
+ protected:
+  // estimates the number of rows that are equal to value / smaller than value
+  float _estimate_equals(const T& value) const;
+  float _estimate_less_than(const T& value) const;
+
+  // returns the estimated share of the rows of the bin that are smaller than a value within [bin.min, bin.max]
+  static float _share_below(const Bin& bin, const T& value);
+
+  std::vector<Bin> _bins;
+  size_t _total_count;
+  size_t _distinct_count;
+};
+
+}  // namespace opossum
@@ -0,0 +1,168 @@
+#include "table_statistics.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+using ValueCounts = std::vector<std::pair<T, size_t>>;
+
+// returns the distinct values of a segment and their number of occurrences, sorted by value
+template <typename T>
+ValueCounts<T> segment_value_counts(const BaseSegment& segment) {
+  auto value_counts = ValueCounts<T>{};
+
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      // Count the value ids; the dictionary already is sorted and unique
+      const auto& dictionary = *typed_segment.dictionary();
+      auto counts = std::vector<size_t>(dictionary.size());
+      resolve_attribute_vector_type(*typed_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        const auto size = attribute_vector.size();
+        for (auto index = size_t{0}; index < size; ++index) ++counts[attribute_vector.get(index)];
+      });
+
+      auto values = std::vector<T>{};
+      if constexpr (std::is_same_v<T, std::string>) {
+        values = dictionary.decode();
+      } else {
+        values = dictionary;
+      }
+
+      value_counts.reserve(values.size());
+      for (auto value_id = size_t{0}; value_id < values.size(); ++value_id) {
+        if (counts[value_id] > 0) value_counts.emplace_back(std::move(values[value_id]), counts[value_id]);
+      }
+      return;
+    }
+
+    // Otherwise, collect (value, count) pairs, one per run for run-length segments
+    if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+      const auto& values = typed_segment.values();
+      const auto& end_positions = typed_segment.end_positions();
+      for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+        const auto run_begin = run_index == 0 ? ChunkOffset{0} : end_positions[run_index - 1] + 1;
+        value_counts.emplace_back(values[run_index], end_positions[run_index] - run_begin + 1);
+      }
+    } else {
+      value_counts.reserve(typed_segment.size());
+      segment_for_each<T>(typed_segment, [&](const T& value, const ChunkOffset) {
+        value_counts.emplace_back(value, 1);
+      });
+    }
+
+    if (value_counts.empty()) return;
+    std::sort(value_counts.begin(), value_counts.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    // combine the counts of equal values
+    auto last_it = value_counts.begin();
+    for (auto input_it = std::next(value_counts.begin()); input_it != value_counts.end(); ++input_it) {
+      if (last_it->first == input_it->first) {
+        last_it->second += input_it->second;
+      } else if (++last_it != input_it) {
+        *last_it = std::move(*input_it);
+      }
+    }
+    value_counts.erase(std::next(last_it), value_counts.end());
+  });
+
+  return value_counts;
+}
+
+// merges two sorted value distributions
+template <typename T>
+ValueCounts<T> merge_value_counts(const ValueCounts<T>& left, const ValueCounts<T>& right) {
+  auto merged = ValueCounts<T>{};
+  merged.reserve(left.size() + right.size());
+
+  auto left_it = left.cbegin();
+  auto right_it = right.cbegin();
+  while (left_it != left.cend() || right_it != right.cend()) {
+    if (right_it == right.cend() || (left_it != left.cend() && left_it->first < right_it->first)) {
+      merged.push_back(*left_it++);
+    } else if (left_it == left.cend() || right_it->first < left_it->first) {
+      merged.push_back(*right_it++);
+    } else {
+      merged.emplace_back(left_it->first, left_it->second + right_it->second);
+      ++left_it;
+      ++right_it;
+    }
+  }
+
+  return merged;
+}
+
+}  // namespace
+
+TableStatistics::TableStatistics(const Table& table, const size_t max_bin_count,
+                                 const HistogramType histogram_type)
+    : _column_histograms(table.column_count()), _row_count(table.row_count()) {
+  const auto chunk_count = table.chunk_count();
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      resolve_data_type(table.column_type(column_id), [&](auto data_type) {
+        using Type = typename decltype(data_type)::type;
+
+        auto chunk_value_counts = std::vector<ValueCounts<Type>>{};
+        for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+          const auto segment = table.get_chunk(chunk_id).get_segment(column_id);
+          chunk_value_counts.emplace_back(segment_value_counts<Type>(*segment));
+        }
+
+        // Merge neighboring distributions until only one is left, so that each value is copied O(log n) times
+        while (chunk_value_counts.size() > 1) {
+          auto merged_value_counts = std::vector<ValueCounts<Type>>{};
+          for (auto index = size_t{0}; index + 1 < chunk_value_counts.size(); index += 2) {
+            merged_value_counts.emplace_back(
+                merge_value_counts(chunk_value_counts[index], chunk_value_counts[index + 1]));
+          }
+          if (chunk_value_counts.size() % 2 == 1) {
+            merged_value_counts.emplace_back(std::move(chunk_value_counts.back()));
+          }
+          chunk_value_counts = std::move(merged_value_counts);
+        }
+
+        const auto value_counts = chunk_value_counts.empty() ? ValueCounts<Type>{} : chunk_value_counts.front();
+        _column_histograms[column_id] = Histogram<Type>::build(value_counts, max_bin_count, histogram_type);
+      });
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+}
+
+size_t TableStatistics::row_count() const { return _row_count; }
+
+float TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                            const AllTypeVariant& value) const {
+  const auto& histogram = *column_histogram(column_id);
+  if (histogram.total_count() == 0) return 0.0f;
+
+  const auto cardinality = histogram.estimate_cardinality(scan_type, value);
+  return std::clamp(cardinality / static_cast<float>(histogram.total_count()), 0.0f, 1.0f);
+}
+
+std::shared_ptr<const BaseHistogram> TableStatistics::column_histogram(const ColumnID column_id) const {
+  return _column_histograms.at(column_id);
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "statistics/histogram.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// TableStatistics holds a histogram for each column of a table and estimates the selectivity of predicates, e.g., to
+// order predicates or choose an access path before a query is executed.
+//
+// The histograms are built from the exact value distribution of each column. It is collected per segment, which is
+// cheap for dictionary segments (the sorted dictionary plus the frequency of each value id) and run-length segments
+// (the runs), and then merged across the chunks of the column. The statistics are a snapshot; they are not updated
+// when rows are appended afterwards.
+class TableStatistics : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_MAX_BIN_COUNT = size_t{100};
+
+  // builds histograms for all columns of the table, one job per column
+  explicit TableStatistics(const Table& table, const size_t max_bin_count = DEFAULT_MAX_BIN_COUNT,
+                           const HistogramType histogram_type = HistogramType::EquiHeight);
+
+  // returns the number of rows at the time the statistics were built
+  size_t row_count() const;
+
+  // Estimates the share of rows (between 0 and 1) for which "column <scan_type> value" holds
+  float estimate_selectivity(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& value) const;
+
+  std::shared_ptr<const BaseHistogram> column_histogram(const ColumnID column_id) const;
+
+ protected:
+  std::vector<std::shared_ptr<const BaseHistogram>> _column_histograms;
+  size_t _row_count;
+};
+
+}  // namespace opossum
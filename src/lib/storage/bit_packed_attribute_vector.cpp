@@ -0,0 +1,110 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width)
+    : _words((size * bit_width + WORD_BITS - 1) / WORD_BITS),
+      _size(size),
+      _bit_width(bit_width),
+      _mask((uint64_t{1} << bit_width) - 1) {
+  Assert(bit_width >= 1 && bit_width <= 32, "Bit width has to be between 1 and 32");
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const std::vector<ValueID::base_type>& value_ids,
+                                                   const uint8_t bit_width)
+    : BitPackedAttributeVector(value_ids.size(), bit_width) {
+  // Values are packed sequentially, so each word is written completely before the next one is started
+  auto word_index = size_t{0};
+  auto bit_offset = size_t{0};
+  for (const auto value_id : value_ids) {
+    DebugAssert(value_id <= _mask, "Value id does not fit into the bit width");
+    const auto value = static_cast<uint64_t>(value_id) & _mask;
+
+    _words[word_index] |= value << bit_offset;
+    if (bit_offset + _bit_width > WORD_BITS) {
+      _words[word_index + 1] |= value >> (WORD_BITS - bit_offset);
+    }
+
+    bit_offset += _bit_width;
+    if (bit_offset >= WORD_BITS) {
+      bit_offset -= WORD_BITS;
+      ++word_index;
+    }
+  }
+}
+
+ValueID BitPackedAttributeVector::get(const size_t index) const {
+  DebugAssert(index < size(), "Index out of bounds");
+
+  const auto bit_position = index * _bit_width;
+  const auto word_index = bit_position / WORD_BITS;
+  const auto bit_offset = bit_position % WORD_BITS;
+
+  auto value = _words[word_index] >> bit_offset;
+  // The value continues in the next word
+  if (bit_offset + _bit_width > WORD_BITS) {
+    value |= _words[word_index + 1] << (WORD_BITS - bit_offset);
+  }
+
+  return ValueID{static_cast<ValueID::base_type>(value & _mask)};
+}
+
+void BitPackedAttributeVector::set(const size_t index, const ValueID value_id) {
+  DebugAssert(index < size(), "Index out of bounds");
+  DebugAssert(static_cast<ValueID::base_type>(value_id) <= _mask, "Value id does not fit into the bit width");
+
+  const auto bit_position = index * _bit_width;
+  const auto word_index = bit_position / WORD_BITS;
+  const auto bit_offset = bit_position % WORD_BITS;
+  const auto value = static_cast<uint64_t>(static_cast<ValueID::base_type>(value_id)) & _mask;
+
+  _words[word_index] = (_words[word_index] & ~(_mask << bit_offset)) | (value << bit_offset);
+  if (bit_offset + _bit_width > WORD_BITS) {
+    const auto shift = WORD_BITS - bit_offset;
+    _words[word_index + 1] = (_words[word_index + 1] & ~(_mask >> shift)) | (value >> shift);
+  }
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return (_bit_width + 7) / 8; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const { return sizeof(uint64_t) * _words.size(); }
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+void BitPackedAttributeVector::decode(const size_t begin, const size_t end, std::vector<ValueID>& output) const {
+  DebugAssert(begin <= end && end <= size(), "Invalid range");
+  output.resize(end - begin);
+
+  auto word_index = begin * _bit_width / WORD_BITS;
+  auto bit_offset = begin * _bit_width % WORD_BITS;
+
+  for (auto& value_id : output) {
+    auto value = _words[word_index] >> bit_offset;
+    if (bit_offset + _bit_width > WORD_BITS) {
+      value |= _words[word_index + 1] << (WORD_BITS - bit_offset);
+    }
+    value_id = ValueID{static_cast<ValueID::base_type>(value & _mask)};
+
+    bit_offset += _bit_width;
+    if (bit_offset >= WORD_BITS) {
+      bit_offset -= WORD_BITS;
+      ++word_index;
+    }
+  }
+}
+
+uint8_t BitPackedAttributeVector::required_bit_width(const uint32_t max_value) {
+  auto bit_width = uint8_t{1};
+  while (bit_width < 32 && (max_value >> bit_width) != 0) {
+    ++bit_width;
+  }
+  return bit_width;
+}
+
+}  // namespace opossum
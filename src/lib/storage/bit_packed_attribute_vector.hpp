@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores each ValueID with the minimal number of bits (1-32) instead of rounding up to
+// 8, 16, or 32 bits like the FixedSizeAttributeVector does. Values are packed back to back into 64-bit words, so a
+// single value may span two words. A segment with 300 unique values, for example, only needs 9 bits per row.
+class BitPackedAttributeVector final : public BaseAttributeVector {
+ public:
+  // creates a zero-initialized vector of the given size where each value uses bit_width bits
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width);
+
+  // creates the vector from the given value ids, which all have to fit into bit_width bits
+  BitPackedAttributeVector(const std::vector<ValueID::base_type>& value_ids, const uint8_t bit_width);
+
+  ValueID get(const size_t index) const override;
+
+  void set(const size_t index, const ValueID value_id) override;
+
+  size_t size() const override;
+
+  // returns the number of bytes needed to hold a single value id, i.e., the bit width rounded up
+  AttributeVectorWidth width() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  // returns the number of bits used per value id
+  uint8_t bit_width() const;
+
+  // Decodes the value ids in [begin, end) into output, which is resized accordingly. This is considerably faster than
+  // calling get() for each position since it walks the packed words sequentially and avoids the virtual call.
+  void decode(const size_t begin, const size_t end, std::vector<ValueID>& output) const;
+
+  // returns the minimal number of bits (at least one) that is needed to represent max_value
+  static uint8_t required_bit_width(const uint32_t max_value);
+
+ private:
+  static constexpr auto WORD_BITS = size_t{64};
+
+  std::vector<uint64_t> _words;
+  size_t _size;
+  uint8_t _bit_width;
+  uint64_t _mask;
+};
+
+}  // namespace opossum
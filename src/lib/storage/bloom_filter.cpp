@@ -0,0 +1,99 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BloomFilter::BloomFilter(const size_t distinct_count, const double false_positive_rate, const size_t max_size) {
+  Assert(false_positive_rate > 0.0 && false_positive_rate < 1.0, "False-positive rate has to be in (0, 1)");
+
+  // Optimal number of bits: m = -n * ln(p) / ln(2)^2
+  const auto value_count = static_cast<double>(std::max(distinct_count, size_t{1}));
+  const auto optimal_bit_count = -value_count * std::log(false_positive_rate) / (std::log(2.0) * std::log(2.0));
+  const auto optimal_word_count = static_cast<size_t>(std::ceil(optimal_bit_count / 64.0));
+  const auto max_word_count = std::max(max_size / sizeof(uint64_t), size_t{1});
+  _words.resize(std::clamp(optimal_word_count, size_t{1}, max_word_count));
+
+  // Optimal number of hash functions for the actual size: k = m / n * ln(2)
+  const auto optimal_hash_count = std::round(static_cast<double>(bit_count()) / value_count * std::log(2.0));
+  _hash_count = static_cast<uint8_t>(std::clamp(optimal_hash_count, 1.0, 16.0));
+}
+
+std::shared_ptr<BloomFilter> BloomFilter::build(const std::string& type, const BaseSegment& segment,
+                                                const size_t distinct_count, const double false_positive_rate,
+                                                const size_t max_size) {
+  const auto bloom_filter = std::make_shared<BloomFilter>(distinct_count, false_positive_rate, max_size);
+
+  resolve_data_type(type, [&](auto data_type) {
+    using Type = typename decltype(data_type)::type;
+
+    resolve_segment_type<Type>(segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+      // Dictionary and run-length segments do not need to look at every value
+      if constexpr (std::is_same_v<SegmentType, DictionarySegment<Type>>) {
+        const auto& dictionary = *typed_segment.dictionary();
+        if constexpr (std::is_same_v<Type, std::string>) {
+          for (const auto& value : dictionary.decode()) bloom_filter->insert(value);
+        } else {
+          for (const auto& value : dictionary) bloom_filter->insert(value);
+        }
+      } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<Type>>) {
+        for (const auto& value : typed_segment.values()) bloom_filter->insert(value);
+      } else {
+        segment_for_each<Type>(typed_segment, [&](const Type& value, const ChunkOffset) {
+          bloom_filter->insert(value);
+        });
+      }
+    });
+  });
+
+  return bloom_filter;
+}
+
+size_t BloomFilter::bit_count() const { return _words.size() * 64; }
+
+uint8_t BloomFilter::hash_count() const { return _hash_count; }
+
+size_t BloomFilter::estimate_memory_usage() const { return _words.size() * sizeof(uint64_t); }
+
+uint64_t BloomFilter::_mix(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+void BloomFilter::_insert_hash(const uint64_t hash) {
+  // Double hashing: the i-th bit is h1 + i * h2, where h2 is odd
+  const auto bits = static_cast<uint64_t>(bit_count());
+  const auto h1 = hash & 0xFFFFFFFFULL;
+  const auto h2 = (hash >> 32) | 1;
+  for (auto index = uint64_t{0}; index < _hash_count; ++index) {
+    const auto bit = (h1 + index * h2) % bits;
+    _words[bit / 64] |= uint64_t{1} << (bit % 64);
+  }
+}
+
+bool BloomFilter::_may_contain_hash(const uint64_t hash) const {
+  const auto bits = static_cast<uint64_t>(bit_count());
+  const auto h1 = hash & 0xFFFFFFFFULL;
+  const auto h2 = (hash >> 32) | 1;
+  for (auto index = uint64_t{0}; index < _hash_count; ++index) {
+    const auto bit = (h1 + index * h2) % bits;
+    if (!(_words[bit / 64] & (uint64_t{1} << (bit % 64)))) return false;
+  }
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// BloomFilter is a compact, probabilistic set of the values of a segment. may_contain() never returns false for a
+// value that was inserted, but may return true for a value that was not (a false positive). This allows equality
+// scans to skip segments for high-cardinality columns, e.g., ids, where the zone map does not help.
+//
+// The filter is sized for a given number of distinct values and false-positive rate. Each value sets hash_count bits
+// that are derived from a single 64-bit hash via double hashing.
+class BloomFilter : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_MAX_SIZE = size_t{1} << 20;
+
+  // Creates an empty filter for distinct_count values with the given false-positive rate. If this would need more
+  // than max_size bytes, the filter is capped and the false-positive rate rises accordingly.
+  BloomFilter(const size_t distinct_count, const double false_positive_rate, const size_t max_size = DEFAULT_MAX_SIZE);
+
+  // Creates a filter of all values of a (non-reference) segment of the given data type
+  static std::shared_ptr<BloomFilter> build(const std::string& type, const BaseSegment& segment,
+                                            const size_t distinct_count, const double false_positive_rate,
+                                            const size_t max_size = DEFAULT_MAX_SIZE);
+
+  template <typename T>
+  void insert(const T& value) {
+    _insert_hash(hash(value));
+  }
+
+  // returns false if the value is definitely not contained
+  template <typename T>
+  bool may_contain(const T& value) const {
+    return _may_contain_hash(hash(value));
+  }
+
+  // returns the number of bits, which is a multiple of 64
+  size_t bit_count() const;
+
+  // returns the number of bits that are set per value
+  uint8_t hash_count() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+  // Hashes a value so that equal values have equal hashes, which also holds for 0.0 and -0.0
+  template <typename T>
+  static uint64_t hash(const T& value) {
+    if constexpr (std::is_floating_point_v<T>) {
+      return _mix(std::hash<T>{}(value == T{0} ? T{0} : value));
+    } else {
+      return _mix(std::hash<T>{}(value));
+    }
+  }
+
+ protected:
+  // std::hash is the identity for integers, so the bits are mixed before they are used (finalizer of MurmurHash3)
+  static uint64_t _mix(uint64_t hash);
+
+  void _insert_hash(const uint64_t hash);
+  bool _may_contain_hash(const uint64_t hash) const;
+
+  std::vector<uint64_t> _words;
+  uint8_t _hash_count;
+};
+
+}  // namespace opossum
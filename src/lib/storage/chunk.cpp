@@ -8,13 +8,19 @@
 #include <vector>
 
 #include "base_segment.hpp"
+#include "bloom_filter.hpp"
 #include "chunk.hpp"
+#include "segment_statistics.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) { _segments.push_back(segment); }
+void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
+  _segments.push_back(segment);
+  _segment_statistics.emplace_back();
+  _segment_bloom_filters.emplace_back();
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert(values.size() == column_count(), "Given value count does not match column count");
@@ -30,7 +36,41 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
-std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { return _segments.at(column_id); }
+std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
+  return std::atomic_load(&_segments.at(column_id));
+}
+
+void Chunk::replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment) {
+  DebugAssert(segment->size() == size(), "Replacing segment has to have the same size");
+  std::atomic_store(&_segments.at(column_id), segment);
+}
+
+std::shared_ptr<const BaseSegmentStatistics> Chunk::get_segment_statistics(ColumnID column_id) const {
+  return std::atomic_load(&_segment_statistics.at(column_id));
+}
+
+void Chunk::set_segment_statistics(ColumnID column_id, std::shared_ptr<const BaseSegmentStatistics> statistics) {
+  std::atomic_store(&_segment_statistics.at(column_id), statistics);
+}
+
+std::shared_ptr<const BloomFilter> Chunk::get_segment_bloom_filter(ColumnID column_id) const {
+  return std::atomic_load(&_segment_bloom_filters.at(column_id));
+}
+
+void Chunk::set_segment_bloom_filter(ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter) {
+  std::atomic_store(&_segment_bloom_filters.at(column_id), bloom_filter);
+}
+
+size_t Chunk::estimate_memory_usage() const {
+  auto memory_usage = size_t{0};
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    memory_usage += get_segment(column_id)->estimate_memory_usage();
+    if (const auto bloom_filter = get_segment_bloom_filter(column_id)) {
+      memory_usage += bloom_filter->estimate_memory_usage();
+    }
+  }
+  return memory_usage;
+}
 
 uint16_t Chunk::column_count() const { return _segments.size(); }
 
@@ -39,7 +79,7 @@ uint32_t Chunk::size() const {
     return 0;
   }
 
-  return _segments[0]->size();
+  return get_segment(ColumnID{0})->size();
 }
 
 }  // namespace opossum
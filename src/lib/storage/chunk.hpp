@@ -15,6 +15,8 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class BaseSegmentStatistics;
+class BloomFilter;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -45,8 +47,31 @@ class Chunk : private Noncopyable {
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Atomically replaces the segment at a given position, e.g., with an encoded version of the same values. Concurrent
+  // readers either see the old or the new segment, and the old one lives on as long as someone still holds it.
+  void replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment);
+
+  // Returns the statistics (zone map) of the segment at a given position, or nullptr if none have been computed. The
+  // Table computes them when a chunk is sealed or compressed.
+  std::shared_ptr<const BaseSegmentStatistics> get_segment_statistics(ColumnID column_id) const;
+
+  // atomically sets the statistics of the segment at a given position
+  void set_segment_statistics(ColumnID column_id, std::shared_ptr<const BaseSegmentStatistics> statistics);
+
+  // Returns the Bloom filter of the segment at a given position, or nullptr if there is none. The Table builds them on
+  // compression if they are enabled.
+  std::shared_ptr<const BloomFilter> get_segment_bloom_filter(ColumnID column_id) const;
+
+  // atomically sets the Bloom filter of the segment at a given position
+  void set_segment_bloom_filter(ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter);
+
+  // returns the calculated memory usage of the segments and their Bloom filters
+  size_t estimate_memory_usage() const;
+
  protected:
   std::vector<std::shared_ptr<BaseSegment>> _segments;
+  std::vector<std::shared_ptr<const BaseSegmentStatistics>> _segment_statistics;
+  std::vector<std::shared_ptr<const BloomFilter>> _segment_bloom_filters;
 };
 
 }  // namespace opossum
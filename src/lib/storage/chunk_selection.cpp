@@ -0,0 +1,144 @@
+#include "chunk_selection.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+ChunkSelection::ChunkSelection(const ChunkOffset chunk_size, std::vector<ChunkOffset> offsets)
+    : _chunk_size(chunk_size), _offsets(std::move(offsets)) {
+  DebugAssert(std::is_sorted(_offsets.cbegin(), _offsets.cend()), "Offsets have to be sorted");
+  DebugAssert(_offsets.empty() || _offsets.back() < chunk_size, "Offsets have to be within the chunk");
+  _choose_representation();
+}
+
+ChunkSelection ChunkSelection::from_bitmap(const ChunkOffset chunk_size, std::vector<uint64_t> words) {
+  DebugAssert(words.size() == (size_t{chunk_size} + 63) / 64, "Bitmap does not match the chunk size");
+
+  auto selection = ChunkSelection{};
+  selection._chunk_size = chunk_size;
+  selection._is_bitmap = true;
+  selection._words = std::move(words);
+  selection._choose_representation();
+  return selection;
+}
+
+ChunkOffset ChunkSelection::chunk_size() const { return _chunk_size; }
+
+size_t ChunkSelection::size() const { return _size; }
+
+bool ChunkSelection::is_bitmap() const { return _is_bitmap; }
+
+bool ChunkSelection::contains(const ChunkOffset chunk_offset) const {
+  if (chunk_offset >= _chunk_size) return false;
+  if (_is_bitmap) return (_words[chunk_offset / 64] >> (chunk_offset % 64)) & 1;
+  return std::binary_search(_offsets.cbegin(), _offsets.cend(), chunk_offset);
+}
+
+size_t ChunkSelection::rank(const ChunkOffset chunk_offset) const {
+  if (!_is_bitmap) {
+    return static_cast<size_t>(std::lower_bound(_offsets.cbegin(), _offsets.cend(), chunk_offset) - _offsets.cbegin());
+  }
+  if (chunk_offset >= _chunk_size) return _size;
+
+  const auto word_index = size_t{chunk_offset / 64};
+  const auto block_index = word_index / RANK_BLOCK_WORDS;
+  auto rank = size_t{_block_ranks[block_index]};
+  for (auto index = block_index * RANK_BLOCK_WORDS; index < word_index; ++index) {
+    rank += __builtin_popcountll(_words[index]);
+  }
+  const auto lower_bits = (uint64_t{1} << (chunk_offset % 64)) - 1;
+  return rank + __builtin_popcountll(_words[word_index] & lower_bits);
+}
+
+std::vector<ChunkOffset> ChunkSelection::offsets() const {
+  if (!_is_bitmap) return _offsets;
+
+  auto offsets = std::vector<ChunkOffset>{};
+  offsets.reserve(_size);
+  for_each([&](const ChunkOffset chunk_offset) { offsets.push_back(chunk_offset); });
+  return offsets;
+}
+
+const std::vector<ChunkOffset>& ChunkSelection::selection_vector() const {
+  DebugAssert(!_is_bitmap, "Selection is stored as a bitmap");
+  return _offsets;
+}
+
+ChunkSelection ChunkSelection::intersect(const ChunkSelection& other) const {
+  DebugAssert(_chunk_size == other._chunk_size, "Selections have to belong to chunks of the same size");
+
+  if (_is_bitmap && other._is_bitmap) {
+    auto words = std::vector<uint64_t>(_words.size());
+    for (auto index = size_t{0}; index < words.size(); ++index) words[index] = _words[index] & other._words[index];
+    return from_bitmap(_chunk_size, std::move(words));
+  }
+
+  auto offsets = std::vector<ChunkOffset>{};
+  if (_is_bitmap || other._is_bitmap) {
+    // probe the bitmap for each entry of the selection vector
+    const auto& bitmap = _is_bitmap ? *this : other;
+    const auto& selection_vector = _is_bitmap ? other._offsets : _offsets;
+    std::copy_if(selection_vector.cbegin(), selection_vector.cend(), std::back_inserter(offsets),
+                 [&](const ChunkOffset chunk_offset) { return bitmap.contains(chunk_offset); });
+  } else {
+    std::set_intersection(_offsets.cbegin(), _offsets.cend(), other._offsets.cbegin(), other._offsets.cend(),
+                          std::back_inserter(offsets));
+  }
+  return ChunkSelection{_chunk_size, std::move(offsets)};
+}
+
+size_t ChunkSelection::estimate_memory_usage() const {
+  return sizeof(ChunkOffset) * _offsets.size() + sizeof(uint64_t) * _words.size() +
+         sizeof(uint32_t) * _block_ranks.size();
+}
+
+void ChunkSelection::_choose_representation() {
+  if (_is_bitmap) {
+    _size = 0;
+    for (const auto word : _words) _size += __builtin_popcountll(word);
+  } else {
+    _size = _offsets.size();
+  }
+
+  // A bitmap takes chunk_size / 8 bytes, a selection vector 4 bytes per selected row
+  const auto use_bitmap = uint64_t{_size} * 32 > _chunk_size;
+  if (use_bitmap && !_is_bitmap) {
+    _words.assign((size_t{_chunk_size} + 63) / 64, 0);
+    for (const auto chunk_offset : _offsets) _words[chunk_offset / 64] |= uint64_t{1} << (chunk_offset % 64);
+    _offsets = {};
+  } else if (!use_bitmap && _is_bitmap) {
+    _offsets = offsets();
+    _words = {};
+  }
+  _is_bitmap = use_bitmap;
+
+  _block_ranks.clear();
+  if (!_is_bitmap) return;
+
+  auto rank = uint32_t{0};
+  for (auto index = size_t{0}; index < _words.size(); ++index) {
+    if (index % RANK_BLOCK_WORDS == 0) _block_ranks.push_back(rank);
+    rank += __builtin_popcountll(_words[index]);
+  }
+}
+
+ChunkOffset ChunkSelection::_select(const size_t index) const {
+  const auto block_it = std::upper_bound(_block_ranks.cbegin(), _block_ranks.cend(), index) - 1;
+  auto remaining = index - *block_it;
+  for (auto word_index = static_cast<size_t>(block_it - _block_ranks.cbegin()) * RANK_BLOCK_WORDS;; ++word_index) {
+    auto word = _words[word_index];
+    const auto popcount = static_cast<size_t>(__builtin_popcountll(word));
+    if (remaining >= popcount) {
+      remaining -= popcount;
+      continue;
+    }
+
+    for (; remaining > 0; --remaining) word &= word - 1;
+    return static_cast<ChunkOffset>(word_index * 64 + __builtin_ctzll(word));
+  }
+}
+
+}  // namespace opossum
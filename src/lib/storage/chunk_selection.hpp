@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// ChunkSelection is a set of rows of a single chunk, e.g., the rows that match a predicate. It is an alternative to
+// lists of RowIDs for intermediate results that stay within a chunk. Depending on which is smaller, the rows are
+// stored as a sorted selection vector of ChunkOffsets (4 bytes per selected row) or as a bitmap (1 bit per row of the
+// chunk). Dense selections thus become bitmaps, which are intersected with a bitwise AND, e.g., to combine the results
+// of conjunctive predicates.
+//
+// Consumers that do not care about the representation iterate over the offsets with for_each. Random access with
+// operator[] takes constant time on selection vectors, but involves a search on bitmaps.
+class ChunkSelection {
+ public:
+  // number of bitmap words per entry of the rank directory, which speeds up operator[] and rank on bitmaps
+  static constexpr auto RANK_BLOCK_WORDS = size_t{8};
+
+  // creates the selection from sorted, distinct offsets in [0, chunk_size)
+  ChunkSelection(const ChunkOffset chunk_size, std::vector<ChunkOffset> offsets);
+
+  // creates the selection from a bitmap in which bit (offset % 64) of words[offset / 64] is set for selected offsets
+  static ChunkSelection from_bitmap(const ChunkOffset chunk_size, std::vector<uint64_t> words);
+
+  // returns the number of rows of the chunk
+  ChunkOffset chunk_size() const;
+
+  // returns the number of selected rows
+  size_t size() const;
+
+  bool is_bitmap() const;
+
+  // returns the index-th selected offset in ascending order
+  ChunkOffset operator[](const size_t index) const {
+    DebugAssert(index < _size, "Index out of bounds");
+    if (!_is_bitmap) return _offsets[index];
+    return _select(index);
+  }
+
+  // returns whether the offset is selected
+  bool contains(const ChunkOffset chunk_offset) const;
+
+  // returns the number of selected offsets that are smaller than the given one
+  size_t rank(const ChunkOffset chunk_offset) const;
+
+  // calls functor(ChunkOffset) for each selected offset in ascending order
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    if (!_is_bitmap) {
+      for (const auto chunk_offset : _offsets) functor(chunk_offset);
+      return;
+    }
+
+    for (auto word_index = size_t{0}; word_index < _words.size(); ++word_index) {
+      for (auto word = _words[word_index]; word; word &= word - 1) {
+        functor(static_cast<ChunkOffset>(word_index * 64 + __builtin_ctzll(word)));
+      }
+    }
+  }
+
+  // returns the selected offsets, which are copied for selection vectors and decoded for bitmaps
+  std::vector<ChunkOffset> offsets() const;
+
+  // returns the selection vector of a selection that is not a bitmap, which allows tight loops
+  const std::vector<ChunkOffset>& selection_vector() const;
+
+  // Returns the rows that are selected by both selections, which have to belong to chunks of the same size. Two
+  // bitmaps are combined word by word.
+  ChunkSelection intersect(const ChunkSelection& other) const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+ protected:
+  ChunkSelection() = default;
+
+  // Switches to whichever representation is smaller, given that the selection is held in _offsets or _words
+  void _choose_representation();
+
+  ChunkOffset _select(const size_t index) const;
+
+  ChunkOffset _chunk_size{0};
+  size_t _size{0};
+  bool _is_bitmap{false};
+
+  std::vector<ChunkOffset> _offsets;
+  std::vector<uint64_t> _words;
+  // number of selected offsets before each block of RANK_BLOCK_WORDS words
+  std::vector<uint32_t> _block_ranks;
+};
+
+}  // namespace opossum
@@ -3,15 +3,20 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
-#include <set>
+#include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "bit_packed_attribute_vector.hpp"
 #include "fixed_size_attribute_vector.hpp"
+#include "front_coded_dictionary.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
+#include "utils/parallel_sort.hpp"
+#include "utils/radix_sort.hpp"
 #include "value_segment.hpp"
 
 namespace opossum {
@@ -26,6 +31,10 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 template <typename T>
 class DictionarySegment : public BaseSegment {
  public:
+  // Strings are kept in a compact front-coded dictionary that avoids a std::string header and heap allocation per
+  // entry. All other types use a plain sorted vector.
+  using Dictionary = std::conditional_t<std::is_same_v<T, std::string>, FrontCodedDictionary, std::vector<T>>;
+
   /**
    * Creates a Dictionary segment from a given value segment.
    */
@@ -33,39 +42,64 @@ class DictionarySegment : public BaseSegment {
     const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
     DebugAssert(value_segment, "Invalid base segment passed to dictionary segment constructor");
 
-    const auto values = value_segment->values();
-
-    // First pass: Fill the dictionary
-    // For faster lookup, we store the elements in a set first
-    std::set<T> distinct_values;
-    for (const auto& value : values) {
-      distinct_values.insert(value);
+    const auto& values = value_segment->values();
+    const auto value_count = values.size();
+
+    // The values are visited in sorted order once. Each value that differs from its predecessor is appended to the
+    // dictionary and all positions are assigned the current dictionary index. The value ids are buffered because the
+    // width of the attribute vector depends on the final dictionary size.
+    auto sorted_values = std::vector<T>{};
+    auto value_ids = std::vector<ValueID::base_type>(value_count);
+    const auto assign_value_id = [&](const T& value, const ChunkOffset position) {
+      if (sorted_values.empty() || sorted_values.back() < value) {
+        sorted_values.push_back(value);
+      }
+      value_ids[position] = static_cast<ValueID::base_type>(sorted_values.size() - 1);
+    };
+
+    if constexpr (std::is_arithmetic_v<T>) {
+      // Sorting (value, position) pairs keeps each value next to its position, so that the assignment pass reads
+      // memory sequentially. Integers are radix sorted.
+      auto sorted_pairs = std::vector<std::pair<T, ChunkOffset>>(value_count);
+      for (auto position = ChunkOffset{0}; position < value_count; ++position) {
+        sorted_pairs[position] = {values[position], position};
+      }
+
+      const auto compare_values = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+      const auto sort_partition = [&](auto& partition) {
+        if constexpr (std::is_integral_v<T>) {
+          radix_sort(partition);
+        } else {
+          std::sort(partition.begin(), partition.end(), compare_values);
+        }
+      };
+      parallel_sort(sorted_pairs, sort_partition, compare_values, MIN_PARALLEL_PARTITION_SIZE);
+
+      for (const auto& [value, position] : sorted_pairs) {
+        assign_value_id(value, position);
+      }
+    } else {
+      // Strings are not moved around. Instead, their positions are sorted.
+      auto sorted_positions = std::vector<ChunkOffset>(value_count);
+      std::iota(sorted_positions.begin(), sorted_positions.end(), ChunkOffset{0});
+
+      const auto compare_values = [&](const auto lhs, const auto rhs) { return values[lhs] < values[rhs]; };
+      const auto sort_partition = [&](auto& partition) {
+        std::sort(partition.begin(), partition.end(), compare_values);
+      };
+      parallel_sort(sorted_positions, sort_partition, compare_values, MIN_PARALLEL_PARTITION_SIZE);
+
+      for (const auto position : sorted_positions) {
+        assign_value_id(values[position], position);
+      }
     }
 
-    // Build an ordered vector based on the set.
-    _dictionary = std::make_shared<std::vector<T>>(distinct_values.cbegin(), distinct_values.cend());
+    _attribute_vector = _create_attribute_vector(value_ids, sorted_values.size());
 
-    const size_t value_size = values.size();
-    const size_t dictionary_size = _dictionary->size();
-
-    if (dictionary_size <= std::numeric_limits<uint8_t>::max()) {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint8_t>>(value_size);
-    } else if (dictionary_size <= std::numeric_limits<uint16_t>::max()) {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint16_t>>(value_size);
-    } else if (dictionary_size <= std::numeric_limits<uint32_t>::max()) {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint32_t>>(value_size);
-    }
-    DebugAssert(_attribute_vector, "Too many unique values");
-
-    // Second pass: Fill the attribute vector
-    for (size_t value_index = 0; value_index < value_size; value_index++) {
-      // The set that we used to construct the _dictionary vector is ordered by the "less" comparator,
-      // so the constructed _dictionary is already sorted. Thus, we can find the index for each
-      // value in the dictionary in O(log(n)).
-      const auto& value = values[value_index];
-      const auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-      size_t dic_index = std::distance(_dictionary->cbegin(), it);
-      _attribute_vector->set(value_index, static_cast<ValueID>(dic_index));
+    if constexpr (std::is_same_v<Dictionary, std::vector<T>>) {
+      _dictionary = std::make_shared<Dictionary>(std::move(sorted_values));
+    } else {
+      _dictionary = std::make_shared<Dictionary>(sorted_values);
     }
   }
 
@@ -86,23 +120,23 @@ class DictionarySegment : public BaseSegment {
   }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary; }
+  std::shared_ptr<const Dictionary> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
   std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
+  T value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
   ValueID lower_bound(T value) const {
-    auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-
-    if (it != _dictionary->cend()) {
-      return static_cast<ValueID>(std::distance(_dictionary->cbegin(), it));
+    if constexpr (std::is_same_v<Dictionary, FrontCodedDictionary>) {
+      return _value_id_or_invalid(_dictionary->lower_bound(value));
+    } else {
+      const auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+      return _value_id_or_invalid(std::distance(_dictionary->cbegin(), it));
     }
-    return INVALID_VALUE_ID;
   }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
@@ -111,12 +145,12 @@ class DictionarySegment : public BaseSegment {
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
   ValueID upper_bound(T value) const {
-    auto it = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
-
-    if (it != _dictionary->cend()) {
-      return static_cast<ValueID>(std::distance(_dictionary->cbegin(), it));
+    if constexpr (std::is_same_v<Dictionary, FrontCodedDictionary>) {
+      return _value_id_or_invalid(_dictionary->upper_bound(value));
+    } else {
+      const auto it = std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value);
+      return _value_id_or_invalid(std::distance(_dictionary->cbegin(), it));
     }
-    return INVALID_VALUE_ID;
   }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
@@ -130,11 +164,60 @@ class DictionarySegment : public BaseSegment {
 
   // returns the calculated memory usage
   size_t estimate_memory_usage() const final {
-    return sizeof(T) * _dictionary->capacity() + _attribute_vector->width() * _attribute_vector->size();
+    if constexpr (std::is_same_v<Dictionary, FrontCodedDictionary>) {
+      return _dictionary->estimate_memory_usage() + _attribute_vector->estimate_memory_usage();
+    } else {
+      return sizeof(T) * _dictionary->capacity() + _attribute_vector->estimate_memory_usage();
+    }
   }
 
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  // translates a dictionary index into a ValueID, indices past the end of the dictionary become INVALID_VALUE_ID
+  ValueID _value_id_or_invalid(const size_t dictionary_index) const {
+    if (dictionary_index < _dictionary->size()) {
+      return static_cast<ValueID>(dictionary_index);
+    }
+    return INVALID_VALUE_ID;
+  }
+
+  // Chooses the smallest attribute vector for the given number of unique values and fills it with the value ids.
+  // Because the bit-packed vector stores whole 64-bit words, a byte-aligned FixedSizeAttributeVector is used whenever
+  // bit-packing does not save memory.
+  static std::shared_ptr<BaseAttributeVector> _create_attribute_vector(
+      const std::vector<ValueID::base_type>& value_ids, const size_t dictionary_size) {
+    DebugAssert(dictionary_size < std::numeric_limits<uint32_t>::max(), "Too many unique values");
+    const auto value_size = value_ids.size();
+
+    // As for the fixed-size vectors, the highest representable value id is never used so that INVALID_VALUE_ID cannot
+    // be confused with a valid one.
+    const auto bit_width = BitPackedAttributeVector::required_bit_width(static_cast<uint32_t>(dictionary_size));
+    const auto bit_packed_size = (value_size * bit_width + 63) / 64 * sizeof(uint64_t);
+
+    auto fixed_width = sizeof(uint32_t);
+    if (dictionary_size <= std::numeric_limits<uint8_t>::max()) {
+      fixed_width = sizeof(uint8_t);
+    } else if (dictionary_size <= std::numeric_limits<uint16_t>::max()) {
+      fixed_width = sizeof(uint16_t);
+    }
+
+    if (bit_packed_size < fixed_width * value_size) {
+      return std::make_shared<BitPackedAttributeVector>(value_ids, bit_width);
+    }
+
+    switch (fixed_width) {
+      case sizeof(uint8_t):
+        return std::make_shared<FixedSizeAttributeVector<uint8_t>>(value_ids);
+      case sizeof(uint16_t):
+        return std::make_shared<FixedSizeAttributeVector<uint16_t>>(value_ids);
+      default:
+        return std::make_shared<FixedSizeAttributeVector<uint32_t>>(value_ids);
+    }
+  }
+
+  // Inputs with more values than this are split into partitions that are sorted concurrently
+  static constexpr auto MIN_PARALLEL_PARTITION_SIZE = size_t{1} << 19;
+
+  std::shared_ptr<Dictionary> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
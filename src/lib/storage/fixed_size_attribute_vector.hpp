@@ -9,10 +9,14 @@
 namespace opossum {
 
 template <typename uintX_t>
-class FixedSizeAttributeVector : public BaseAttributeVector {
+class FixedSizeAttributeVector final : public BaseAttributeVector {
  public:
   explicit FixedSizeAttributeVector(size_t size) : _values_ids(size) {}
 
+  // creates the vector from the given value ids, which all have to fit into uintX_t
+  explicit FixedSizeAttributeVector(const std::vector<ValueID::base_type>& value_ids)
+      : _values_ids(value_ids.cbegin(), value_ids.cend()) {}
+
   ValueID get(const size_t index) const override {
     DebugAssert(index < size(), "Index out of bounds");
     return ValueID{_values_ids[index]};
@@ -27,6 +31,11 @@ class FixedSizeAttributeVector : public BaseAttributeVector {
 
   AttributeVectorWidth width() const override { return sizeof(uintX_t); }
 
+  size_t estimate_memory_usage() const override { return sizeof(uintX_t) * _values_ids.size(); }
+
+  // returns the underlying value ids, which allows tight loops without a virtual call per value
+  const std::vector<uintX_t>& values() const { return _values_ids; }
+
  private:
   std::vector<uintX_t> _values_ids;
 };
@@ -0,0 +1,159 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto WORD_BITS = size_t{64};
+
+// returns the minimal number of bits that is needed to represent max_value, zero if it is zero
+uint8_t required_bit_width(const uint64_t max_value) {
+  return max_value == 0 ? 0 : static_cast<uint8_t>(WORD_BITS - __builtin_clzll(max_value));
+}
+
+// reads the value of bit_width bits at bit_position, which may span two words
+uint64_t read_bits(const uint64_t* words, const size_t bit_position, const uint8_t bit_width) {
+  if (bit_width == 0) return 0;
+
+  const auto word_index = bit_position / WORD_BITS;
+  const auto shift = bit_position % WORD_BITS;
+  auto value = words[word_index] >> shift;
+  // shift is not zero here, as bit_width is at most 64
+  if (shift + bit_width > WORD_BITS) value |= words[word_index + 1] << (WORD_BITS - shift);
+  return bit_width == WORD_BITS ? value : value & ((uint64_t{1} << bit_width) - 1);
+}
+
+void write_bits(uint64_t* words, const size_t bit_position, const uint8_t bit_width, const uint64_t value) {
+  if (bit_width == 0) return;
+
+  const auto word_index = bit_position / WORD_BITS;
+  const auto shift = bit_position % WORD_BITS;
+  words[word_index] |= value << shift;
+  if (shift + bit_width > WORD_BITS) words[word_index + 1] |= value >> (WORD_BITS - shift);
+}
+
+}  // namespace
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  DebugAssert(value_segment, "Invalid base segment passed to frame-of-reference segment constructor");
+
+  const auto& values = value_segment->values();
+  _size = values.size();
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+  // First pass: Find the minimum and the bit width of each block
+  _block_minima.reserve(block_count);
+  _block_bit_widths.reserve(block_count);
+  _block_word_begins.reserve(block_count);
+  auto word_count = size_t{0};
+  for (auto block_begin = size_t{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+    const auto [min_it, max_it] = std::minmax_element(values.cbegin() + block_begin, values.cbegin() + block_end);
+    // Unsigned arithmetic avoids the overflow of max - min for large value ranges
+    const auto max_offset = static_cast<uint64_t>(static_cast<UnsignedT>(*max_it) - static_cast<UnsignedT>(*min_it));
+    const auto bit_width = required_bit_width(max_offset);
+
+    _block_minima.push_back(*min_it);
+    _block_bit_widths.push_back(bit_width);
+    _block_word_begins.push_back(word_count);
+    word_count += ((block_end - block_begin) * bit_width + WORD_BITS - 1) / WORD_BITS;
+  }
+
+  // Second pass: Store the offsets
+  _words.resize(word_count);
+  for (auto chunk_offset = size_t{0}; chunk_offset < _size; ++chunk_offset) {
+    const auto block_index = chunk_offset / BLOCK_SIZE;
+    const auto block_minimum = static_cast<UnsignedT>(_block_minima[block_index]);
+    const auto offset = static_cast<uint64_t>(static_cast<UnsignedT>(values[chunk_offset]) - block_minimum);
+    const auto bit_width = _block_bit_widths[block_index];
+    write_bits(_words.data() + _block_word_begins[block_index], (chunk_offset % BLOCK_SIZE) * bit_width, bit_width,
+               offset);
+  }
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  return get(chunk_offset);
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const size_t chunk_offset) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto block_minimum = static_cast<UnsignedT>(_block_minima[chunk_offset / BLOCK_SIZE]);
+  return static_cast<T>(block_minimum + static_cast<UnsignedT>(_offset(chunk_offset)));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decode_block(const size_t block_index, std::vector<T>& output) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+  DebugAssert(block_index < _block_minima.size(), "Block index out of bounds");
+
+  const auto block_begin = block_index * BLOCK_SIZE;
+  const auto block_end = std::min(block_begin + BLOCK_SIZE, size());
+
+  // unpack the offsets first, so that adding the minimum is a tight loop
+  output.resize(block_end - block_begin);
+  const auto* words = _words.data() + _block_word_begins[block_index];
+  const auto bit_width = _block_bit_widths[block_index];
+  for (auto index = size_t{0}; index < output.size(); ++index) {
+    output[index] = static_cast<T>(read_bits(words, index * bit_width, bit_width));
+  }
+
+  const auto block_minimum = static_cast<UnsignedT>(_block_minima[block_index]);
+  for (auto& value : output) value = static_cast<T>(block_minimum + static_cast<UnsignedT>(value));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const AllTypeVariant&) {
+  throw std::runtime_error("append() called on immutable frame-of-reference segment");
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+const std::vector<T>& FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+const std::vector<uint8_t>& FrameOfReferenceSegment<T>::block_bit_widths() const {
+  return _block_bit_widths;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return sizeof(T) * _block_minima.capacity() + sizeof(uint8_t) * _block_bit_widths.capacity() +
+         sizeof(size_t) * _block_word_begins.capacity() + sizeof(uint64_t) * _words.capacity();
+}
+
+template <typename T>
+uint64_t FrameOfReferenceSegment<T>::_offset(const size_t chunk_offset) const {
+  const auto block_index = chunk_offset / BLOCK_SIZE;
+  const auto bit_width = _block_bit_widths[block_index];
+  return read_bits(_words.data() + _block_word_begins[block_index], (chunk_offset % BLOCK_SIZE) * bit_width, bit_width);
+}
+
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
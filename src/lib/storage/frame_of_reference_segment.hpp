@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is an immutable segment type for integer columns ("int" and "long"). The values are split
+// into blocks of BLOCK_SIZE values. For each block, the minimum is stored and each value is encoded as its offset to
+// that minimum. The offsets of a block are bit-packed with the bit width (0-64) that its largest offset needs, so a
+// single block with a wide value range does not widen the others. Columns with a narrow value range per block
+// (timestamps, increasing ids) thus need only a few bits per value.
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+  static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>,
+                "Frame-of-reference encoding is only supported for int and long");
+
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{2048};
+
+  // creates a frame-of-reference segment from a given value segment
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position.
+  T get(const size_t chunk_offset) const;
+
+  // Decodes all values of the block with the given index into output, which is resized to the block's size. The
+  // block minimum is added in a tight loop over the bulk-decoded offsets that the compiler can vectorize.
+  void decode_block(const size_t block_index, std::vector<T>& output) const;
+
+  // frame-of-reference segments are immutable
+  void append(const AllTypeVariant&) final;
+
+  // return the number of entries
+  size_t size() const final;
+
+  // returns the minimum of each block
+  const std::vector<T>& block_minima() const;
+
+  // returns the number of bits per offset of each block
+  const std::vector<uint8_t>& block_bit_widths() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  // returns the offset at the given position
+  uint64_t _offset(const size_t chunk_offset) const;
+
+  size_t _size;
+  std::vector<T> _block_minima;
+  std::vector<uint8_t> _block_bit_widths;
+  // index of the first word of each block, blocks start at word boundaries
+  std::vector<size_t> _block_word_begins;
+  std::vector<uint64_t> _words;
+};
+
+}  // namespace opossum
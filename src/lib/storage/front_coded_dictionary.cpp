@@ -0,0 +1,187 @@
+#include "front_coded_dictionary.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Lengths are stored as variable-length integers with seven bits per byte. Most prefixes and suffixes are shorter
+// than 128 characters and thus take a single byte.
+void write_length(std::vector<char>& data, size_t length) {
+  while (length >= 0x80) {
+    data.push_back(static_cast<char>((length & 0x7F) | 0x80));
+    length >>= 7;
+  }
+  data.push_back(static_cast<char>(length));
+}
+
+size_t read_length(const std::vector<char>& data, size_t& position) {
+  auto length = size_t{0};
+  auto shift = size_t{0};
+  while (true) {
+    const auto byte = static_cast<uint8_t>(data[position++]);
+    length |= static_cast<size_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return length;
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+FrontCodedDictionary::FrontCodedDictionary(const std::vector<std::string>& sorted_values)
+    : _size(sorted_values.size()) {
+  DebugAssert(std::adjacent_find(sorted_values.cbegin(), sorted_values.cend(), std::greater_equal<>{}) ==
+                  sorted_values.cend(),
+              "Values have to be sorted and unique");
+
+  _block_offsets.reserve((_size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+  for (auto index = size_t{0}; index < _size; ++index) {
+    const auto& value = sorted_values[index];
+
+    if (index % BLOCK_SIZE == 0) {
+      _block_offsets.push_back(_data.size());
+      write_length(_data, value.size());
+      _data.insert(_data.end(), value.cbegin(), value.cend());
+      continue;
+    }
+
+    const auto& previous = sorted_values[index - 1];
+    const auto max_prefix_length = std::min(previous.size(), value.size());
+    auto prefix_length = size_t{0};
+    while (prefix_length < max_prefix_length && previous[prefix_length] == value[prefix_length]) ++prefix_length;
+
+    write_length(_data, prefix_length);
+    write_length(_data, value.size() - prefix_length);
+    _data.insert(_data.end(), value.cbegin() + prefix_length, value.cend());
+  }
+
+  _data.shrink_to_fit();
+}
+
+size_t FrontCodedDictionary::size() const { return _size; }
+
+bool FrontCodedDictionary::empty() const { return _size == 0; }
+
+std::string FrontCodedDictionary::operator[](const size_t index) const {
+  DebugAssert(index < _size, "Index out of bounds");
+
+  const auto block_index = index / BLOCK_SIZE;
+  auto position = _block_offsets[block_index];
+
+  const auto head_length = read_length(_data, position);
+  auto value = std::string(_data.data() + position, head_length);
+  position += head_length;
+
+  // Reconstruct the following entries of the block until the requested one is reached
+  for (auto entry = block_index * BLOCK_SIZE; entry < index; ++entry) {
+    const auto prefix_length = read_length(_data, position);
+    const auto suffix_length = read_length(_data, position);
+    value.resize(prefix_length);
+    value.append(_data.data() + position, suffix_length);
+    position += suffix_length;
+  }
+
+  return value;
+}
+
+std::string FrontCodedDictionary::at(const size_t index) const {
+  if (index >= _size) throw std::out_of_range("FrontCodedDictionary index out of range");
+  return (*this)[index];
+}
+
+std::vector<std::string> FrontCodedDictionary::decode() const {
+  auto values = std::vector<std::string>{};
+  values.reserve(_size);
+
+  auto position = size_t{0};
+  for (auto index = size_t{0}; index < _size; ++index) {
+    if (index % BLOCK_SIZE == 0) {
+      const auto head_length = read_length(_data, position);
+      values.emplace_back(_data.data() + position, head_length);
+      position += head_length;
+      continue;
+    }
+
+    const auto prefix_length = read_length(_data, position);
+    const auto suffix_length = read_length(_data, position);
+    auto value = values.back().substr(0, prefix_length);
+    value.append(_data.data() + position, suffix_length);
+    values.emplace_back(std::move(value));
+    position += suffix_length;
+  }
+
+  return values;
+}
+
+size_t FrontCodedDictionary::lower_bound(const std::string& value) const {
+  return _find_first(value, [](const std::string_view& search, const std::string_view& entry) {
+    return !(entry < search);
+  });
+}
+
+size_t FrontCodedDictionary::upper_bound(const std::string& value) const {
+  return _find_first(value, [](const std::string_view& search, const std::string_view& entry) {
+    return search < entry;
+  });
+}
+
+size_t FrontCodedDictionary::estimate_memory_usage() const {
+  return _data.capacity() + sizeof(size_t) * _block_offsets.capacity();
+}
+
+std::string_view FrontCodedDictionary::_block_head(const size_t block_index) const {
+  auto position = _block_offsets[block_index];
+  const auto length = read_length(_data, position);
+  return std::string_view(_data.data() + position, length);
+}
+
+template <typename Comparator>
+size_t FrontCodedDictionary::_find_first(const std::string& value, const Comparator& comparator) const {
+  // The comparator is monotonic over the sorted entries. Find the first block whose head satisfies it; the result is
+  // either that head or one of the entries in the preceding block.
+  auto block_begin = size_t{0};
+  auto block_end = _block_offsets.size();
+  while (block_begin < block_end) {
+    const auto block_middle = block_begin + (block_end - block_begin) / 2;
+    if (comparator(value, _block_head(block_middle))) {
+      block_end = block_middle;
+    } else {
+      block_begin = block_middle + 1;
+    }
+  }
+
+  if (block_begin == 0) return 0;
+
+  // Scan the preceding block, whose head does not satisfy the comparator
+  const auto block_index = block_begin - 1;
+  const auto last_entry = std::min((block_index + 1) * BLOCK_SIZE, _size);
+  auto position = _block_offsets[block_index];
+
+  const auto head_length = read_length(_data, position);
+  auto entry = std::string(_data.data() + position, head_length);
+  position += head_length;
+
+  for (auto index = block_index * BLOCK_SIZE + 1; index < last_entry; ++index) {
+    const auto prefix_length = read_length(_data, position);
+    const auto suffix_length = read_length(_data, position);
+    entry.resize(prefix_length);
+    entry.append(_data.data() + position, suffix_length);
+    position += suffix_length;
+
+    if (comparator(value, entry)) return index;
+  }
+
+  return last_entry;
+}
+
+}  // namespace opossum
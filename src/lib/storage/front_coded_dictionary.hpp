@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// FrontCodedDictionary is a compact, immutable replacement for a sorted std::vector<std::string>. The strings are
+// grouped into blocks of BLOCK_SIZE. The first string of each block is stored completely, every following string only
+// stores the length of the prefix it shares with its predecessor and the remaining suffix. All blocks are written
+// into one contiguous buffer, so there is neither a std::string header nor a heap allocation per entry.
+//
+// Lookups binary search over the first strings of the blocks, which can be compared in place, and then decode at most
+// one block. Sorted string columns such as URLs share long prefixes and therefore compress well.
+class FrontCodedDictionary : private Noncopyable {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{16};
+
+  // creates the dictionary from sorted, unique values
+  explicit FrontCodedDictionary(const std::vector<std::string>& sorted_values);
+
+  // returns the number of entries
+  size_t size() const;
+
+  bool empty() const;
+
+  // returns the value at a given index, which is decoded on the fly
+  std::string operator[](const size_t index) const;
+
+  // same as operator[], but throws std::out_of_range for invalid indices
+  std::string at(const size_t index) const;
+
+  // decodes all entries at once, which is much cheaper than calling operator[] for each of them
+  std::vector<std::string> decode() const;
+
+  // returns the index of the first entry >= value, or size() if there is none
+  size_t lower_bound(const std::string& value) const;
+
+  // returns the index of the first entry > value, or size() if there is none
+  size_t upper_bound(const std::string& value) const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+ protected:
+  // returns the (uncompressed) first string of a block without copying it
+  std::string_view _block_head(const size_t block_index) const;
+
+  // returns the index of the first entry for which the comparator of value and entry returns true
+  template <typename Comparator>
+  size_t _find_first(const std::string& value, const Comparator& comparator) const;
+
+  std::vector<char> _data;
+  std::vector<size_t> _block_offsets;
+  size_t _size;
+};
+
+}  // namespace opossum
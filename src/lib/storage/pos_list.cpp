@@ -0,0 +1,114 @@
+#include "pos_list.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+PosList::PosList(std::initializer_list<RowID> row_ids) : PosList(std::vector<RowID>(row_ids)) {}
+
+PosList::PosList(std::vector<RowID> row_ids) : _row_ids(std::move(row_ids)) {
+  if (_row_ids.empty()) return;
+
+  _single_chunk_id = _row_ids.front().chunk_id;
+  _references_single_chunk = std::all_of(_row_ids.cbegin(), _row_ids.cend(), [&](const RowID& row_id) {
+    return row_id.chunk_id == _single_chunk_id;
+  });
+  _is_sorted = std::is_sorted(_row_ids.cbegin(), _row_ids.cend());
+}
+
+std::shared_ptr<PosList> PosList::entire_chunk(const ChunkID chunk_id, const ChunkOffset chunk_size) {
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->_is_entire_chunk = true;
+  pos_list->_entire_chunk_size = chunk_size;
+  pos_list->_single_chunk_id = chunk_id;
+  return pos_list;
+}
+
+std::shared_ptr<PosList> PosList::chunk_selection(const ChunkID chunk_id,
+                                                  const std::shared_ptr<const ChunkSelection>& selection) {
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->_selection = selection;
+  pos_list->_single_chunk_id = chunk_id;
+  return pos_list;
+}
+
+PosList::Iterator PosList::begin() const { return Iterator(*this, 0); }
+
+PosList::Iterator PosList::end() const { return Iterator(*this, size()); }
+
+void PosList::reserve(const size_t capacity) {
+  DebugAssert(is_materialized(), "Only materialized lists can be modified");
+  _row_ids.reserve(capacity);
+}
+
+bool PosList::is_materialized() const { return !_is_entire_chunk && !_selection; }
+
+bool PosList::is_entire_chunk() const { return _is_entire_chunk; }
+
+const std::shared_ptr<const ChunkSelection>& PosList::selection() const { return _selection; }
+
+bool PosList::references_single_chunk() const { return _references_single_chunk; }
+
+ChunkID PosList::single_chunk_id() const {
+  DebugAssert(_references_single_chunk, "PosList references multiple chunks");
+  return _single_chunk_id;
+}
+
+bool PosList::is_sorted() const { return _is_sorted; }
+
+bool PosList::benefits_from_grouping(const size_t begin, const size_t end) const {
+  if (_references_single_chunk || _is_sorted || end - begin < MIN_AVERAGE_RUN_LENGTH) return false;
+
+  auto run_count = size_t{1};
+  for (auto index = begin + 1; index < end; ++index) {
+    if (_row_ids[index].chunk_id != _row_ids[index - 1].chunk_id) ++run_count;
+  }
+  return (end - begin) / run_count < MIN_AVERAGE_RUN_LENGTH;
+}
+
+PosList::ChunkGroups PosList::group_by_chunk(const size_t begin, const size_t end) const {
+  DebugAssert(is_materialized(), "Positions are not materialized");
+
+  auto max_chunk_id = ChunkID{0};
+  for (auto index = begin; index < end; ++index) max_chunk_id = std::max(max_chunk_id, _row_ids[index].chunk_id);
+
+  // position_counts[chunk_id + 1] is first the number of positions in the chunk, then the index of its first position
+  auto position_counts = std::vector<size_t>(max_chunk_id + 2);
+  for (auto index = begin; index < end; ++index) ++position_counts[_row_ids[index].chunk_id + 1];
+
+  auto groups = ChunkGroups{};
+  for (auto chunk_id = ChunkID{0}; chunk_id <= max_chunk_id; ++chunk_id) {
+    if (position_counts[chunk_id + 1] > 0) {
+      groups.chunk_ids.push_back(chunk_id);
+      groups.group_begins.push_back(position_counts[chunk_id]);
+    }
+    position_counts[chunk_id + 1] += position_counts[chunk_id];
+  }
+  groups.group_begins.push_back(end - begin);
+
+  groups.indices.resize(end - begin);
+  for (auto index = begin; index < end; ++index) {
+    groups.indices[position_counts[_row_ids[index].chunk_id]++] = static_cast<ChunkOffset>(index);
+  }
+  return groups;
+}
+
+const std::vector<RowID>& PosList::row_ids() const {
+  DebugAssert(is_materialized(), "Positions are not materialized");
+  return _row_ids;
+}
+
+size_t PosList::estimate_memory_usage() const {
+  return sizeof(RowID) * _row_ids.size() + (_selection ? _selection->estimate_memory_usage() : 0);
+}
+
+bool PosList::operator==(const PosList& other) const {
+  return size() == other.size() && std::equal(begin(), end(), other.begin());
+}
+
+bool PosList::operator!=(const PosList& other) const { return !(*this == other); }
+
+}  // namespace opossum
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+#include "chunk_selection.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// PosList is the list of positions (RowIDs) that a ReferenceSegment refers to. Usually, the positions are materialized.
+// If they cover all rows of a chunk in order, e.g., because a predicate matched every row, they can instead be
+// represented lazily by the chunk id and its size, which takes constant memory (see entire_chunk). Positions within a
+// single chunk can also be represented by a ChunkSelection, i.e., a selection vector or bitmap (see chunk_selection).
+//
+// The list keeps track of whether all positions refer to the same chunk and whether they are sorted. Consumers use
+// this to resolve the referenced segment only once or to access it sequentially. Both properties are maintained by
+// push_back and can only get lost, i.e., they never have to be set by hand.
+class PosList {
+ public:
+  class Iterator;
+  using value_type = RowID;
+
+  // The positions of a range of the list, grouped by the chunk that they refer to. The indices (into the list) of the
+  // positions that refer to chunk_ids[i] are indices[group_begins[i]] to indices[group_begins[i + 1] - 1], in their
+  // original order.
+  struct ChunkGroups {
+    std::vector<ChunkID> chunk_ids;
+    std::vector<size_t> group_begins;
+    std::vector<ChunkOffset> indices;
+  };
+
+  // Grouping only pays off if the runs of consecutive positions in the same chunk are shorter than this on average
+  static constexpr auto MIN_AVERAGE_RUN_LENGTH = size_t{16};
+
+  PosList() = default;
+  PosList(std::initializer_list<RowID> row_ids);
+  explicit PosList(std::vector<RowID> row_ids);
+
+  // creates a list that references all rows [0, chunk_size) of the given chunk without materializing them
+  static std::shared_ptr<PosList> entire_chunk(const ChunkID chunk_id, const ChunkOffset chunk_size);
+
+  // creates a list that references the selected rows of the given chunk in ascending order
+  static std::shared_ptr<PosList> chunk_selection(const ChunkID chunk_id,
+                                                  const std::shared_ptr<const ChunkSelection>& selection);
+
+  RowID operator[](const size_t index) const {
+    DebugAssert(index < size(), "Index out of bounds");
+    if (_is_entire_chunk) return RowID{_single_chunk_id, static_cast<ChunkOffset>(index)};
+    if (_selection) return RowID{_single_chunk_id, (*_selection)[index]};
+    return _row_ids[index];
+  }
+
+  size_t size() const {
+    if (_is_entire_chunk) return _entire_chunk_size;
+    return _selection ? _selection->size() : _row_ids.size();
+  }
+  bool empty() const { return size() == 0; }
+
+  Iterator begin() const;
+  Iterator end() const;
+
+  void reserve(const size_t capacity);
+
+  // appends a position and updates whether the list references a single chunk and is sorted
+  void push_back(const RowID& row_id) {
+    DebugAssert(is_materialized(), "Only materialized lists can be modified");
+    if (_row_ids.empty()) {
+      _single_chunk_id = row_id.chunk_id;
+    } else {
+      _references_single_chunk &= row_id.chunk_id == _single_chunk_id;
+      _is_sorted &= !(row_id < _row_ids.back());
+    }
+    _row_ids.push_back(row_id);
+  }
+
+  void emplace_back(const RowID& row_id) { push_back(row_id); }
+
+  // returns whether the positions are stored as RowIDs, i.e., neither as an entire chunk nor as a selection
+  bool is_materialized() const;
+
+  // returns whether the list references all rows of a single chunk lazily
+  bool is_entire_chunk() const;
+
+  // returns the selection of the single referenced chunk if the list was created from one, nullptr otherwise
+  const std::shared_ptr<const ChunkSelection>& selection() const;
+
+  // Returns whether all positions refer to the same chunk, which is returned by single_chunk_id. This also holds for
+  // empty lists.
+  bool references_single_chunk() const;
+  ChunkID single_chunk_id() const;
+
+  // returns whether the positions are in ascending order
+  bool is_sorted() const;
+
+  // Returns whether the positions in [begin, end) switch between chunks so often that grouping them with
+  // group_by_chunk is cheaper than processing each run of consecutive positions in the same chunk separately, e.g.,
+  // because a referenced segment is resolved per run.
+  bool benefits_from_grouping(const size_t begin, const size_t end) const;
+
+  // groups the positions in [begin, end) by chunk with a counting sort
+  ChunkGroups group_by_chunk(const size_t begin, const size_t end) const;
+
+  // returns the positions of a materialized list
+  const std::vector<RowID>& row_ids() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+  bool operator==(const PosList& other) const;
+  bool operator!=(const PosList& other) const;
+
+ protected:
+  std::vector<RowID> _row_ids;
+
+  bool _is_entire_chunk{false};
+  ChunkOffset _entire_chunk_size{0};
+
+  std::shared_ptr<const ChunkSelection> _selection;
+
+  bool _references_single_chunk{true};
+  ChunkID _single_chunk_id{0};
+  bool _is_sorted{true};
+};
+
+// iterates over the positions of a PosList, which are returned by value as they might not be materialized
+class PosList::Iterator
+    : public boost::iterator_facade<PosList::Iterator, RowID, boost::random_access_traversal_tag, RowID> {
+ public:
+  Iterator(const PosList& pos_list, const size_t index) : _pos_list(&pos_list), _index(index) {}
+
+ private:
+  friend class boost::iterator_core_access;
+
+  RowID dereference() const { return (*_pos_list)[_index]; }
+  bool equal(const Iterator& other) const { return _index == other._index; }
+  void increment() { ++_index; }
+  void decrement() { --_index; }
+  void advance(const std::ptrdiff_t n) { _index += n; }
+  std::ptrdiff_t distance_to(const Iterator& other) const {
+    return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+  }
+
+  const PosList* _pos_list;
+  size_t _index;
+};
+
+}  // namespace opossum
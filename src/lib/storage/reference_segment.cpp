@@ -0,0 +1,40 @@
+#include "reference_segment.hpp"
+
+#include <memory>
+
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {
+  // Chains of references would have to be followed for every access. Operators resolve them when creating their output.
+  if (IS_DEBUG) {
+    const auto& first_chunk = _referenced_table->get_chunk(ChunkID{0});
+    if (first_chunk.column_count() > _referenced_column_id) {
+      DebugAssert(!std::dynamic_pointer_cast<const ReferenceSegment>(first_chunk.get_segment(_referenced_column_id)),
+                  "ReferenceSegments have to reference data segments, not other ReferenceSegments");
+    }
+  }
+}
+
+AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  const auto& row_id = (*_pos_list)[chunk_offset];
+  const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk.get_segment(_referenced_column_id))[row_id.chunk_offset];
+}
+
+size_t ReferenceSegment::size() const { return _pos_list->size(); }
+
+const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceSegment::referenced_column_id() const { return _referenced_column_id; }
+
+size_t ReferenceSegment::estimate_memory_usage() const { return _pos_list->estimate_memory_usage(); }
+
+}  // namespace opossum
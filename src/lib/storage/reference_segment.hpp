@@ -9,6 +9,7 @@
 
 #include "base_segment.hpp"
 #include "dictionary_segment.hpp"
+#include "pos_list.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -16,7 +17,8 @@
 
 namespace opossum {
 
-// ReferenceSegment is a specific segment type that stores all its values as position list of a referenced segment
+// ReferenceSegment is a specific segment type that stores all its values as position list of a referenced segment.
+// The position list may reference an entire chunk lazily (see PosList::entire_chunk).
 class ReferenceSegment : public BaseSegment {
  public:
   // creates a reference segment
@@ -34,6 +36,14 @@ class ReferenceSegment : public BaseSegment {
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
+
+  // returns the calculated memory usage of the position list, which may be shared with other reference segments
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
 };
 
 }  // namespace opossum
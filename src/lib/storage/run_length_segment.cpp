@@ -0,0 +1,78 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(base_segment);
+  DebugAssert(value_segment, "Invalid base segment passed to run-length segment constructor");
+
+  const auto& values = value_segment->values();
+  const auto value_count = values.size();
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_count; ++chunk_offset) {
+    // A run ends at the last position or where the next value differs
+    if (chunk_offset + 1 == value_count || values[chunk_offset] != values[chunk_offset + 1]) {
+      _values.push_back(values[chunk_offset]);
+      _end_positions.push_back(chunk_offset);
+    }
+  }
+
+  _values.shrink_to_fit();
+  _end_positions.shrink_to_fit();
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  return get(chunk_offset);
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const size_t chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Chunk offset out of bounds");
+
+  // The first run that ends at or after the offset contains it
+  const auto run_it = std::lower_bound(_end_positions.cbegin(), _end_positions.cend(), chunk_offset);
+  return _values[std::distance(_end_positions.cbegin(), run_it)];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant&) {
+  throw std::runtime_error("append() called on immutable run-length segment");
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::size() const {
+  return _end_positions.empty() ? 0 : _end_positions.back() + 1;
+}
+
+template <typename T>
+const std::vector<T>& RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return sizeof(T) * _values.capacity() + sizeof(ChunkOffset) * _end_positions.capacity();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
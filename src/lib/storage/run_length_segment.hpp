@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is an immutable segment type that stores consecutive equal values only once, together with the
+// position at which their run ends. Sorted or clustered columns consist of few, long runs and shrink accordingly.
+// Operators can evaluate a predicate once per run instead of once per row.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  /**
+   * Creates a run-length encoded segment from a given value segment.
+   */
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // return the value at a certain position. This requires a binary search over the runs.
+  T get(const size_t chunk_offset) const;
+
+  // run-length segments are immutable
+  void append(const AllTypeVariant&) final;
+
+  // return the number of entries
+  size_t size() const final;
+
+  // returns the value of each run
+  const std::vector<T>& values() const;
+
+  // returns the last chunk offset (inclusive) of each run, values()[i] is valid up to end_positions()[i]
+  const std::vector<ChunkOffset>& end_positions() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::vector<T> _values;
+  std::vector<ChunkOffset> _end_positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,306 @@
+#pragma once
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+/**
+ * This file provides typed access to the values of segments. In contrast to BaseSegment::operator[], which returns an
+ * AllTypeVariant through a virtual call for each value, the segment type is resolved once and the values are passed
+ * on in a loop that the compiler can specialize for each segment type:
+ *
+ *   segment_for_each<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) { ... });
+ *
+ *   segment_with_iterators<T>(segment, [&](auto begin, auto end) {
+ *     for (auto it = begin; it != end; ++it) {
+ *       const auto position = *it;  // SegmentPosition<T> with value and chunk_offset
+ *     }
+ *   });
+ *
+ * T has to be the data type of the segment, e.g., resolved with resolve_data_type. The lambdas are instantiated once
+ * for each segment type, so they should be generic and not too large. For reference segments, chunk_offset is the
+ * offset within the reference segment, not within the referenced segment.
+ */
+
+namespace opossum {
+
+template <typename T, typename Functor>
+void segment_for_each(const BaseSegment& segment, const Functor& functor);
+
+// a typed value of a segment and its offset
+template <typename T>
+struct SegmentPosition {
+  T value;
+  ChunkOffset chunk_offset;
+};
+
+namespace detail {
+
+// Passes a callable that returns the value at a given offset of the segment on to functor. access_count is the
+// expected number of accesses, which decides whether it pays off to decode a string dictionary as a whole.
+template <typename T, typename Functor>
+void with_point_accessor(const BaseSegment& segment, const size_t access_count, const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      const auto& values = typed_segment.values();
+      functor([&](const ChunkOffset chunk_offset) -> const T& { return values[chunk_offset]; });
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      const auto& dictionary = *typed_segment.dictionary();
+      resolve_attribute_vector_type(*typed_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        if constexpr (std::is_same_v<T, std::string>) {
+          // Front-coded entries have to be decoded. Unless only a few values are accessed, decoding the dictionary as
+          // a whole is cheaper than decoding an entry per access.
+          if (access_count < dictionary.size()) {
+            functor([&](const ChunkOffset chunk_offset) { return dictionary[attribute_vector.get(chunk_offset)]; });
+            return;
+          }
+          const auto decoded_dictionary = dictionary.decode();
+          functor([&](const ChunkOffset chunk_offset) -> const T& {
+            return decoded_dictionary[attribute_vector.get(chunk_offset)];
+          });
+        } else {
+          functor([&](const ChunkOffset chunk_offset) -> const T& {
+            return dictionary[attribute_vector.get(chunk_offset)];
+          });
+        }
+      });
+    } else if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      Fail("Reference segments have to reference data segments");
+    } else {
+      // RunLengthSegment and FrameOfReferenceSegment
+      functor([&](const ChunkOffset chunk_offset) { return typed_segment.get(chunk_offset); });
+    }
+  });
+}
+
+// Passes a callable on to functor that prefetches the value at a given offset of the segment into the cache. Issuing
+// it a few accesses ahead hides the latency of random accesses. For segments whose values cannot be located without
+// decoding, e.g., run-length or bit-packed ones, it does nothing.
+template <typename T, typename Functor>
+void with_prefetcher(const BaseSegment& segment, const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      const auto* values = typed_segment.values().data();
+      functor([values](const ChunkOffset chunk_offset) { __builtin_prefetch(values + chunk_offset); });
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      resolve_attribute_vector_type(*typed_segment.attribute_vector(), [&](const auto& attribute_vector) {
+        using AttributeVectorType = std::decay_t<decltype(attribute_vector)>;
+        if constexpr (std::is_same_v<AttributeVectorType, BitPackedAttributeVector>) {
+          functor([](const ChunkOffset) {});
+        } else {
+          const auto* value_ids = attribute_vector.values().data();
+          functor([value_ids](const ChunkOffset chunk_offset) { __builtin_prefetch(value_ids + chunk_offset); });
+        }
+      });
+    } else {
+      functor([](const ChunkOffset) {});
+    }
+  });
+}
+
+// Iterates over the referenced values. Consecutive positions in the same chunk are processed together, so the
+// referenced segment is only resolved once per group. If the positions switch between chunks too often, the values
+// are gathered chunk by chunk first. If the positions reference an entire chunk, its segment is iterated directly.
+template <typename T, typename Functor>
+void reference_segment_for_each(const ReferenceSegment& segment, const Functor& functor) {
+  const auto& pos_list = *segment.pos_list();
+  const auto& referenced_table = *segment.referenced_table();
+  const auto referenced_column_id = segment.referenced_column_id();
+
+  if (pos_list.is_entire_chunk()) {
+    const auto& referenced_chunk = referenced_table.get_chunk(pos_list.single_chunk_id());
+    segment_for_each<T>(*referenced_chunk.get_segment(referenced_column_id), functor);
+    return;
+  }
+
+  if (const auto& selection = pos_list.selection()) {
+    const auto& referenced_chunk = referenced_table.get_chunk(pos_list.single_chunk_id());
+    with_point_accessor<T>(*referenced_chunk.get_segment(referenced_column_id), selection->size(),
+                           [&](const auto& accessor) {
+                             auto index = ChunkOffset{0};
+                             selection->for_each([&](const ChunkOffset chunk_offset) {
+                               functor(accessor(chunk_offset), index++);
+                             });
+                           });
+    return;
+  }
+
+  const auto& row_ids = pos_list.row_ids();
+  if (pos_list.benefits_from_grouping(0, row_ids.size())) {
+    const auto groups = pos_list.group_by_chunk(0, row_ids.size());
+    auto values = std::vector<T>(row_ids.size());
+    for (auto group_id = size_t{0}; group_id < groups.chunk_ids.size(); ++group_id) {
+      const auto group_begin = groups.group_begins[group_id];
+      const auto group_end = groups.group_begins[group_id + 1];
+      const auto& referenced_chunk = referenced_table.get_chunk(groups.chunk_ids[group_id]);
+      with_point_accessor<T>(*referenced_chunk.get_segment(referenced_column_id), group_end - group_begin,
+                             [&](const auto& accessor) {
+                               for (auto group_index = group_begin; group_index < group_end; ++group_index) {
+                                 const auto index = groups.indices[group_index];
+                                 values[index] = accessor(row_ids[index].chunk_offset);
+                               }
+                             });
+    }
+
+    for (auto index = size_t{0}; index < values.size(); ++index) {
+      functor(values[index], static_cast<ChunkOffset>(index));
+    }
+    return;
+  }
+
+  auto group_begin = size_t{0};
+  while (group_begin < row_ids.size()) {
+    const auto chunk_id = row_ids[group_begin].chunk_id;
+    auto group_end = pos_list.references_single_chunk() ? row_ids.size() : group_begin + 1;
+    while (group_end < row_ids.size() && row_ids[group_end].chunk_id == chunk_id) ++group_end;
+
+    const auto referenced_segment = referenced_table.get_chunk(chunk_id).get_segment(referenced_column_id);
+    with_point_accessor<T>(*referenced_segment, group_end - group_begin, [&](const auto& accessor) {
+      for (auto index = group_begin; index < group_end; ++index) {
+        functor(accessor(row_ids[index].chunk_offset), static_cast<ChunkOffset>(index));
+      }
+    });
+
+    group_begin = group_end;
+  }
+}
+
+// iterator that accesses the values by their offset
+template <typename T, typename Accessor>
+class PointAccessIterator : public boost::iterator_facade<PointAccessIterator<T, Accessor>, SegmentPosition<T>,
+                                                          boost::random_access_traversal_tag, SegmentPosition<T>> {
+ public:
+  PointAccessIterator(const Accessor& accessor, const ChunkOffset chunk_offset)
+      : _accessor(&accessor), _chunk_offset(chunk_offset) {}
+
+ private:
+  friend class boost::iterator_core_access;
+
+  SegmentPosition<T> dereference() const { return {(*_accessor)(_chunk_offset), _chunk_offset}; }
+  bool equal(const PointAccessIterator& other) const { return _chunk_offset == other._chunk_offset; }
+  void increment() { ++_chunk_offset; }
+  void decrement() { --_chunk_offset; }
+  void advance(const std::ptrdiff_t n) { _chunk_offset += n; }
+  std::ptrdiff_t distance_to(const PointAccessIterator& other) const {
+    return static_cast<std::ptrdiff_t>(other._chunk_offset) - static_cast<std::ptrdiff_t>(_chunk_offset);
+  }
+
+  // Lambdas are not assignable, so the iterator refers to the accessor instead of holding a copy
+  const Accessor* _accessor;
+  ChunkOffset _chunk_offset;
+};
+
+// iterator that walks the runs of a RunLengthSegment instead of searching the run for each offset
+template <typename T>
+class RunLengthIterator : public boost::iterator_facade<RunLengthIterator<T>, SegmentPosition<T>,
+                                                        boost::forward_traversal_tag, SegmentPosition<T>> {
+ public:
+  RunLengthIterator(const RunLengthSegment<T>& segment, const ChunkOffset chunk_offset, const size_t run_index)
+      : _values(&segment.values()),
+        _end_positions(&segment.end_positions()),
+        _chunk_offset(chunk_offset),
+        _run_index(run_index) {}
+
+ private:
+  friend class boost::iterator_core_access;
+
+  SegmentPosition<T> dereference() const { return {(*_values)[_run_index], _chunk_offset}; }
+  bool equal(const RunLengthIterator& other) const { return _chunk_offset == other._chunk_offset; }
+  void increment() {
+    if (_chunk_offset == (*_end_positions)[_run_index]) ++_run_index;
+    ++_chunk_offset;
+  }
+
+  const std::vector<T>* _values;
+  const std::vector<ChunkOffset>* _end_positions;
+  ChunkOffset _chunk_offset;
+  size_t _run_index;
+};
+
+}  // namespace detail
+
+// calls functor(const T& value, ChunkOffset chunk_offset) for each value of the segment in order
+template <typename T, typename Functor>
+void segment_for_each(const BaseSegment& segment, const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      detail::reference_segment_for_each<T>(typed_segment, functor);
+    } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+      const auto& values = typed_segment.values();
+      const auto& end_positions = typed_segment.end_positions();
+      auto chunk_offset = ChunkOffset{0};
+      for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+        for (; chunk_offset <= end_positions[run_index]; ++chunk_offset) {
+          functor(values[run_index], chunk_offset);
+        }
+      }
+    } else if constexpr (std::is_same_v<SegmentType, ValueSegment<T>> ||
+                         std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      const auto size = static_cast<ChunkOffset>(typed_segment.size());
+      detail::with_point_accessor<T>(typed_segment, size, [&](const auto& accessor) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+          functor(accessor(chunk_offset), chunk_offset);
+        }
+      });
+    } else {
+      // FrameOfReferenceSegment, decoded block by block
+      auto block = std::vector<T>{};
+      const auto block_count = typed_segment.block_minima().size();
+      for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+        typed_segment.decode_block(block_index, block);
+        const auto block_begin = static_cast<ChunkOffset>(block_index * SegmentType::BLOCK_SIZE);
+        for (auto index = ChunkOffset{0}; index < block.size(); ++index) {
+          functor(block[index], block_begin + index);
+        }
+      }
+    }
+  });
+}
+
+// Calls functor(begin, end) with iterators over the values of the segment, which dereference to SegmentPosition<T>.
+// Reference segments are materialized first.
+template <typename T, typename Functor>
+void segment_with_iterators(const BaseSegment& segment, const Functor& functor) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    const auto size = static_cast<ChunkOffset>(typed_segment.size());
+
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      auto values = std::vector<T>{};
+      values.reserve(size);
+      segment_for_each<T>(typed_segment, [&](const T& value, const ChunkOffset) { values.push_back(value); });
+
+      const auto accessor = [&](const ChunkOffset chunk_offset) -> const T& { return values[chunk_offset]; };
+      using Iterator = detail::PointAccessIterator<T, decltype(accessor)>;
+      functor(Iterator(accessor, 0), Iterator(accessor, size));
+    } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+      using Iterator = detail::RunLengthIterator<T>;
+      functor(Iterator(typed_segment, 0, 0), Iterator(typed_segment, size, typed_segment.values().size()));
+    } else {
+      detail::with_point_accessor<T>(typed_segment, size, [&](const auto& accessor) {
+        using Iterator = detail::PointAccessIterator<T, std::decay_t<decltype(accessor)>>;
+        functor(Iterator(accessor, 0), Iterator(accessor, size));
+      });
+    }
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#include "segment_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+SegmentStatistics<T>::SegmentStatistics(const T& min, const T& max, const size_t distinct_count,
+                                        const size_t null_count)
+    : _min(min), _max(max), _distinct_count(distinct_count), _null_count(null_count) {
+  DebugAssert(!(max < min), "Maximum must not be smaller than minimum");
+}
+
+template <typename T>
+std::shared_ptr<SegmentStatistics<T>> SegmentStatistics<T>::build(const BaseSegment& segment) {
+  if (segment.size() == 0) return nullptr;
+
+  auto statistics = std::shared_ptr<SegmentStatistics<T>>{};
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      Fail("Statistics are only built for data segments");
+    } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+      // The dictionary is sorted and holds each value exactly once
+      const auto& dictionary = *typed_segment.dictionary();
+      statistics = std::make_shared<SegmentStatistics<T>>(dictionary[0], dictionary[dictionary.size() - 1],
+                                                          dictionary.size());
+    } else {
+      // Run-length segments only need to look at one value per run, all others at every value
+      auto values = std::vector<T>{};
+      if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+        values = typed_segment.values();
+      } else {
+        values.reserve(typed_segment.size());
+        segment_for_each<T>(typed_segment, [&](const T& value, const ChunkOffset) { values.push_back(value); });
+      }
+
+      std::sort(values.begin(), values.end());
+      const auto distinct_count = std::distance(values.begin(), std::unique(values.begin(), values.end()));
+      statistics = std::make_shared<SegmentStatistics<T>>(values.front(), values[distinct_count - 1],
+                                                          static_cast<size_t>(distinct_count));
+    }
+  });
+
+  return statistics;
+}
+
+template <typename T>
+bool SegmentStatistics<T>::can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  const auto value = type_cast<T>(search_value);
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return value < _min || _max < value;
+    case ScanType::OpNotEquals:
+      return _min == value && _max == value;
+    case ScanType::OpLessThan:
+      return !(_min < value);
+    case ScanType::OpLessThanEquals:
+      return value < _min;
+    case ScanType::OpGreaterThan:
+      return !(value < _max);
+    case ScanType::OpGreaterThanEquals:
+      return _max < value;
+  }
+  Fail("Unknown scan type");
+}
+
+template <typename T>
+const T& SegmentStatistics<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const T& SegmentStatistics<T>::max() const {
+  return _max;
+}
+
+template <typename T>
+size_t SegmentStatistics<T>::distinct_count() const {
+  return _distinct_count;
+}
+
+template <typename T>
+size_t SegmentStatistics<T>::null_count() const {
+  return _null_count;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SegmentStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// BaseSegmentStatistics is the abstract super class of SegmentStatistics. The statistics of a segment are a zone map
+// (minimum and maximum) plus the number of distinct and NULL values. Operators use them to skip whole chunks.
+class BaseSegmentStatistics : private Noncopyable {
+ public:
+  virtual ~BaseSegmentStatistics() = default;
+
+  // Returns true if no value of the segment can satisfy "value <scan_type> search_value", i.e., if the segment can be
+  // skipped. The search value is cast to the data type of the segment, as in the TableScan.
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  virtual size_t distinct_count() const = 0;
+
+  // Segments cannot contain NULL values yet, so this is always zero
+  virtual size_t null_count() const = 0;
+};
+
+template <typename T>
+class SegmentStatistics : public BaseSegmentStatistics {
+ public:
+  SegmentStatistics(const T& min, const T& max, const size_t distinct_count, const size_t null_count = 0);
+
+  // Computes the statistics of a non-reference segment of data type T, or returns nullptr if it is empty. For
+  // dictionary and run-length segments, this does not touch the individual values.
+  static std::shared_ptr<SegmentStatistics<T>> build(const BaseSegment& segment);
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
+  const T& min() const;
+  const T& max() const;
+
+  size_t distinct_count() const override;
+  size_t null_count() const override;
+
+ protected:
+  const T _min;
+  const T _max;
+  const size_t _distinct_count;
+  const size_t _null_count;
+};
+
+}  // namespace opossum
@@ -2,66 +2,95 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "run_length_segment.hpp"
+#include "segment_statistics.hpp"
 #include "value_segment.hpp"
 
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
 
 namespace opossum {
 
-Table::Table(const uint32_t chunk_size) : _max_chunk_size(chunk_size) {
+Table::Table(const uint32_t chunk_size)
+    : _max_chunk_size(chunk_size == 0 ? std::numeric_limits<ChunkOffset>::max() - 1 : chunk_size) {
   // On table creation, a first chunk shall be created.
   _append_new_chunk();
 }
 
+Table::~Table() {
+  // Only jobs that are not done need the TaskScheduler. It executes all queued tasks before it is destroyed, so it is
+  // not accessed if it is destroyed before the table, e.g., for the tables of the StorageManager.
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  {
+    const std::lock_guard<std::mutex> lock(_chunks_mutex);
+    std::copy_if(_background_jobs.cbegin(), _background_jobs.cend(), std::back_inserter(jobs),
+                 [](const auto& job) { return job && !job->is_done(); });
+  }
+  if (jobs.empty()) return;
+
+  // Jobs that failed rethrow their exceptions here, which must not escape the destructor
+  try {
+    TaskScheduler::get().wait_for_tasks(jobs);
+  } catch (...) {
+  }
+}
+
 void Table::add_column_definition(const std::string& name, const std::string& type) {
-  // Implementation goes here
+  if (_background_encoding_type) _assert_encoding_supported(*_background_encoding_type, type);
+
+  _column_names.push_back(name);
+  _column_types.push_back(type);
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
   DebugAssert(row_count() == 0, "You can only add columns when no data has been added");
+  if (_background_encoding_type) _assert_encoding_supported(*_background_encoding_type, type);
 
   _column_names.push_back(name);
   _column_types.push_back(type);
 
   const std::lock_guard<std::mutex> lock(_chunks_mutex);
-  _chunks.back().add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
+  _chunks.back()->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
-  if (_chunks.back().size() >= _max_chunk_size) {
+  auto& last_chunk = get_chunk(static_cast<ChunkID>(chunk_count() - 1));
+  if (last_chunk.size() >= _max_chunk_size) {
     _append_new_chunk();
+    get_chunk(static_cast<ChunkID>(chunk_count() - 1)).append(values);
+    return;
   }
 
-  const std::lock_guard<std::mutex> lock(_chunks_mutex);
-  _chunks.back().append(values);
+  last_chunk.append(values);
 }
 
-void Table::create_new_chunk() {
-  // Implementation goes here
-}
+void Table::create_new_chunk() { _append_new_chunk(); }
 
 uint16_t Table::column_count() const {
-  // At creation of the table, a chunk is created. It is not possible to delete a chunk (only to emplace it).
-  // Thus, _chunks[0] should always exist.
-  const std::lock_guard<std::mutex> lock(_chunks_mutex);
-  return _chunks[0].column_count();
+  // Tables whose columns were added with add_column_definition may not have any segments yet
+  return static_cast<uint16_t>(_column_names.size());
 }
 
 uint64_t Table::row_count() const {
   // static cast on the 0 is needed to make the compiler pick the correct type for the accumulate template.
   const std::lock_guard<std::mutex> lock(_chunks_mutex);
   return std::accumulate(_chunks.cbegin(), _chunks.cend(), static_cast<uint64_t>(0),
-                         [](uint64_t sum, const Chunk& chunk) { return sum + chunk.size(); });
+                         [](uint64_t sum, const std::shared_ptr<Chunk>& chunk) { return sum + chunk->size(); });
 }
 
 ChunkID Table::chunk_count() const {
@@ -90,55 +119,203 @@ const std::string& Table::column_type(ColumnID column_id) const { return _column
 
 Chunk& Table::get_chunk(ChunkID chunk_id) {
   const std::lock_guard<std::mutex> lock(_chunks_mutex);
-  return _chunks.at(chunk_id);
+  return *_chunks.at(chunk_id);
 }
 
 const Chunk& Table::get_chunk(ChunkID chunk_id) const {
   const std::lock_guard<std::mutex> lock(_chunks_mutex);
-  return _chunks.at(chunk_id);
+  return *_chunks.at(chunk_id);
 }
 
 void Table::_append_new_chunk() {
-  Chunk new_chunk;
+  auto new_chunk = std::make_shared<Chunk>();
 
   for (const auto& column_type : _column_types) {
-    new_chunk.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(column_type));
+    new_chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(column_type));
   }
 
   const std::lock_guard<std::mutex> lock(_chunks_mutex);
+
+  // The previous chunk is full and will not be appended to anymore. It is compressed and its statistics are computed
+  // off the insert path.
+  if (!_chunks.empty()) {
+    const auto sealed_chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+    const auto encoding_type = _background_encoding_type;
+    auto job = std::make_shared<JobTask>([this, sealed_chunk_id, encoding_type]() {
+      _compress_chunk(sealed_chunk_id, encoding_type, true);
+
+      // Finished jobs are not kept for each chunk. Failed ones are, so that wait_for_background_compression rethrows.
+      const std::lock_guard<std::mutex> lock(_chunks_mutex);
+      _background_jobs[sealed_chunk_id] = nullptr;
+    });
+
+    _background_jobs.resize(_chunks.size());
+    _background_jobs[sealed_chunk_id] = job;
+    job->schedule();
+  }
+
   _chunks.push_back(std::move(new_chunk));
 }
 
-void Table::compress_chunk(ChunkID chunk_id) {
-  const auto& uncompressed_chunk = get_chunk(chunk_id);
-  Chunk compressed_chunk = Chunk();
-
-  std::vector<std::future<std::shared_ptr<BaseSegment>>> compressed_segment_futures;
+void Table::compress_chunk(ChunkID chunk_id, EncodingType encoding_type) {
+  _assert_encoding_supported(encoding_type);
 
-  const auto col_count = column_count();
-  for (ColumnID column_id = ColumnID{0}; column_id < col_count; ++column_id) {
-    const auto uncompressed_segment = uncompressed_chunk.get_segment(column_id);
-    std::promise<std::shared_ptr<BaseSegment>> promise;
-    compressed_segment_futures.push_back(promise.get_future());
-    std::thread thread(_compress_segment, std::move(promise), column_type(column_id), uncompressed_segment);
-    thread.detach();
+  auto background_job = std::shared_ptr<AbstractTask>{};
+  {
+    const std::lock_guard<std::mutex> lock(_chunks_mutex);
+    if (chunk_id < _background_jobs.size()) background_job = _background_jobs[chunk_id];
   }
+  if (background_job) background_job->join();
 
-  for (auto& compressed_segment_future : compressed_segment_futures) {
-    compressed_chunk.add_segment(compressed_segment_future.get());
+  _compress_chunk(chunk_id, encoding_type, false);
+}
+
+void Table::set_background_compression(const std::optional<EncodingType>& encoding_type) {
+  if (encoding_type) _assert_encoding_supported(*encoding_type);
+
+  const std::lock_guard<std::mutex> lock(_chunks_mutex);
+  _background_encoding_type = encoding_type;
+}
+
+const std::optional<EncodingType>& Table::background_compression() const { return _background_encoding_type; }
+
+void Table::set_bloom_filters(const std::optional<double>& false_positive_rate, const size_t max_size) {
+  if (false_positive_rate) {
+    Assert(*false_positive_rate > 0.0 && *false_positive_rate < 1.0, "False-positive rate has to be in (0, 1)");
   }
 
   const std::lock_guard<std::mutex> lock(_chunks_mutex);
-  _chunks[chunk_id] = std::move(compressed_chunk);
+  _bloom_filter_false_positive_rate = false_positive_rate;
+  _bloom_filter_max_size = max_size;
 }
 
-void Table::_compress_segment(std::promise<std::shared_ptr<BaseSegment>> promise, const std::string type,
-                              const std::shared_ptr<BaseSegment> uncompressed_segment) {
-  promise.set_value(make_shared_by_data_type<BaseSegment, DictionarySegment>(type, uncompressed_segment));
+std::shared_ptr<const TableStatistics> Table::table_statistics() const {
+  return std::atomic_load(&_table_statistics);
 }
 
-void emplace_chunk(Chunk chunk) {
-  // Implementation goes here
+void Table::set_table_statistics(const std::shared_ptr<const TableStatistics>& table_statistics) {
+  std::atomic_store(&_table_statistics, table_statistics);
+}
+
+void Table::wait_for_background_compression() const {
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  {
+    const std::lock_guard<std::mutex> lock(_chunks_mutex);
+    std::copy_if(_background_jobs.cbegin(), _background_jobs.cend(), std::back_inserter(jobs),
+                 [](const auto& job) { return job != nullptr; });
+  }
+
+  TaskScheduler::get().wait_for_tasks(jobs);
+}
+
+void Table::_assert_encoding_supported(const EncodingType encoding_type) const {
+  for (const auto& type : _column_types) _assert_encoding_supported(encoding_type, type);
+}
+
+void Table::_assert_encoding_supported(const EncodingType encoding_type, const std::string& type) {
+  if (encoding_type != EncodingType::FrameOfReference) return;
+
+  Assert(type == "int" || type == "long", "Frame-of-reference encoding is only supported for int and long columns");
+}
+
+void Table::_compress_chunk(const ChunkID chunk_id, const std::optional<EncodingType>& encoding_type,
+                            const bool skip_encoded_segments) {
+  auto& chunk = get_chunk(chunk_id);
+
+  auto bloom_filter_false_positive_rate = std::optional<double>{};
+  auto bloom_filter_max_size = size_t{0};
+  {
+    const std::lock_guard<std::mutex> lock(_chunks_mutex);
+    bloom_filter_false_positive_rate = _bloom_filter_false_positive_rate;
+    bloom_filter_max_size = _bloom_filter_max_size;
+  }
+
+  // Process the segments concurrently, one job per column. Each segment is swapped in as soon as it is encoded.
+  const auto col_count = chunk.column_count();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(col_count);
+  for (ColumnID column_id = ColumnID{0}; column_id < col_count; ++column_id) {
+    const auto segment = chunk.get_segment(column_id);
+    const auto& type = column_type(column_id);
+
+    auto is_value_segment = false;
+    resolve_data_type(type, [&](auto data_type) {
+      using Type = typename decltype(data_type)::type;
+      is_value_segment = std::dynamic_pointer_cast<ValueSegment<Type>>(segment) != nullptr;
+    });
+    const auto encode = encoding_type && (is_value_segment || !skip_encoded_segments);
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, segment, type, is_value_segment, column_id, encode]() {
+      auto processed_segment = segment;
+      if (encode) {
+        const auto value_segment = is_value_segment ? segment : _materialize_segment(type, segment);
+        processed_segment = _compress_segment(type, value_segment, *encoding_type);
+        chunk.replace_segment(column_id, processed_segment);
+      }
+
+      // The statistics of encoded segments are cheaper to compute, e.g., from the dictionary
+      auto statistics = std::shared_ptr<BaseSegmentStatistics>{};
+      resolve_data_type(type, [&](auto data_type) {
+        using Type = typename decltype(data_type)::type;
+        statistics = SegmentStatistics<Type>::build(*processed_segment);
+      });
+      chunk.set_segment_statistics(column_id, statistics);
+
+      if (bloom_filter_false_positive_rate && statistics) {
+        chunk.set_segment_bloom_filter(
+            column_id, BloomFilter::build(type, *processed_segment, statistics->distinct_count(),
+                                          *bloom_filter_false_positive_rate, bloom_filter_max_size));
+      }
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+}
+
+std::shared_ptr<BaseSegment> Table::_materialize_segment(const std::string& type,
+                                                         const std::shared_ptr<BaseSegment>& segment) {
+  PerformanceWarning("Encoded segment is decoded for re-encoding");
+
+  auto value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>(type);
+  const auto size = static_cast<ChunkOffset>(segment->size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    value_segment->append((*segment)[chunk_offset]);
+  }
+  return value_segment;
+}
+
+std::shared_ptr<BaseSegment> Table::_compress_segment(const std::string& type,
+                                                      const std::shared_ptr<BaseSegment>& uncompressed_segment,
+                                                      const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Dictionary:
+      return make_shared_by_data_type<BaseSegment, DictionarySegment>(type, uncompressed_segment);
+    case EncodingType::RunLength:
+      return make_shared_by_data_type<BaseSegment, RunLengthSegment>(type, uncompressed_segment);
+    case EncodingType::FrameOfReference: {
+      auto compressed_segment = std::shared_ptr<BaseSegment>{};
+      resolve_data_type(type, [&](auto data_type) {
+        using Type = typename decltype(data_type)::type;
+        if constexpr (std::is_same_v<Type, int32_t> || std::is_same_v<Type, int64_t>) {
+          compressed_segment = std::make_shared<FrameOfReferenceSegment<Type>>(uncompressed_segment);
+        } else {
+          Fail("Frame-of-reference encoding is only supported for int and long columns");
+        }
+      });
+      return compressed_segment;
+    }
+  }
+  Fail("Unknown encoding type");
+}
+
+void Table::emplace_chunk(Chunk chunk) {
+  DebugAssert(chunk.column_count() == column_count(), "Chunk has to have a segment for each column");
+
+  const std::lock_guard<std::mutex> lock(_chunks_mutex);
+  if (_chunks.size() == 1 && _chunks[0]->size() == 0) {
+    _chunks[0] = std::make_shared<Chunk>(std::move(chunk));
+    return;
+  }
+  _chunks.push_back(std::make_shared<Chunk>(std::move(chunk)));
 }
 
 }  // namespace opossum
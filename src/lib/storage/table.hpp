@@ -1,15 +1,16 @@
 #pragma once
 
-#include <future>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "bloom_filter.hpp"
 #include "chunk.hpp"
 
 #include "type_cast.hpp"
@@ -18,6 +19,7 @@
 
 namespace opossum {
 
+class AbstractTask;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
@@ -25,13 +27,15 @@ class Table : private Noncopyable {
  public:
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
-  // default is the maximum chunk size minus 1. A table holds always at least one chunk
+  // default is the maximum chunk size minus 1, which is also used for 0. A table holds always at least one chunk
   explicit Table(const uint32_t chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
 
-  // we need to explicitly set the move constructor to default when
-  // we overwrite the copy constructor
-  Table(Table&&) = default;
-  Table& operator=(Table&&) = default;
+  // tables cannot be moved, as the background compression jobs capture this
+  Table(Table&&) = delete;
+  Table& operator=(Table&&) = delete;
+
+  // waits for pending background compression jobs
+  ~Table();
 
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t column_count() const;
@@ -71,6 +75,7 @@ class Table : private Noncopyable {
   // adds column definition without creating the actual columns
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
+  // both this and add_column fail if the background compression does not support the type
   void add_column_definition(const std::string& name, const std::string& type);
 
   // adds a column to the end, i.e., right, of the table
@@ -85,13 +90,47 @@ class Table : private Noncopyable {
   // creates a new chunk and appends it
   void create_new_chunk();
 
-  // compresses a ValueSegment into a DictionarySegment
-  void compress_chunk(ChunkID chunk_id);
+  // Compresses the segments of a chunk with the given encoding, by default into DictionarySegments, and computes their
+  // statistics. Segments that are already encoded are re-encoded. If the chunk is being compressed in the background,
+  // this waits for it first.
+  void compress_chunk(ChunkID chunk_id, EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Sets the encoding that full chunks are compressed with in the background, std::nullopt disables it. Whenever
+  // append() starts a new chunk, the previous one is sealed and handed to the TaskScheduler, which encodes its
+  // ValueSegments and swaps them into the chunk. The default is dictionary encoding. Either way, the statistics of the
+  // segments of sealed chunks (see Chunk::get_segment_statistics) are computed in the background.
+  void set_background_compression(const std::optional<EncodingType>& encoding_type);
+  const std::optional<EncodingType>& background_compression() const;
+
+  // Enables Bloom filters (see Chunk::get_segment_bloom_filter) with the given false-positive rate for segments that
+  // are compressed from now on, std::nullopt disables them. Each filter uses at most max_size bytes. They are
+  // disabled by default.
+  void set_bloom_filters(const std::optional<double>& false_positive_rate,
+                         const size_t max_size = BloomFilter::DEFAULT_MAX_SIZE);
+
+  // Returns the statistics that were set for the table, or nullptr. They are not maintained automatically, as they
+  // would become outdated with every appended row.
+  std::shared_ptr<const TableStatistics> table_statistics() const;
+  void set_table_statistics(const std::shared_ptr<const TableStatistics>& table_statistics);
+
+  // blocks until all background jobs for chunks that have been sealed so far are done
+  void wait_for_background_compression() const;
 
  protected:
-  std::vector<Chunk> _chunks;
+  // Chunks are held by pointer so that they keep their address when _chunks grows. This allows background jobs and
+  // callers of get_chunk to access them without holding _chunks_mutex.
+  std::vector<std::shared_ptr<Chunk>> _chunks;
   mutable std::mutex _chunks_mutex;
 
+  std::optional<EncodingType> _background_encoding_type = EncodingType::Dictionary;
+  std::shared_ptr<const TableStatistics> _table_statistics;
+
+  std::optional<double> _bloom_filter_false_positive_rate;
+  size_t _bloom_filter_max_size = BloomFilter::DEFAULT_MAX_SIZE;
+  // the job that compresses a sealed chunk and computes its statistics, nullptr if there is none or it succeeded
+  // (guarded by _chunks_mutex)
+  std::vector<std::shared_ptr<AbstractTask>> _background_jobs;
+
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
 
@@ -99,7 +138,23 @@ class Table : private Noncopyable {
 
   void _append_new_chunk();
 
-  static void _compress_segment(std::promise<std::shared_ptr<BaseSegment>> promise, const std::string type,
-                                const std::shared_ptr<BaseSegment> uncompressed_segment);
+  // fails if one of the columns or the given type cannot be encoded with the encoding type
+  void _assert_encoding_supported(const EncodingType encoding_type) const;
+  static void _assert_encoding_supported(const EncodingType encoding_type, const std::string& type);
+
+  // Encodes the segments of a chunk concurrently, swaps them into it, and computes their statistics and, if enabled,
+  // Bloom filters. If
+  // skip_encoded_segments is set, only ValueSegments are encoded. Without an encoding, only the statistics are
+  // computed.
+  void _compress_chunk(const ChunkID chunk_id, const std::optional<EncodingType>& encoding_type,
+                       const bool skip_encoded_segments);
+
+  // returns a ValueSegment with the values of an encoded segment
+  static std::shared_ptr<BaseSegment> _materialize_segment(const std::string& type,
+                                                           const std::shared_ptr<BaseSegment>& segment);
+
+  static std::shared_ptr<BaseSegment> _compress_segment(const std::string& type,
+                                                        const std::shared_ptr<BaseSegment>& uncompressed_segment,
+                                                        const EncodingType encoding_type);
 };
 }  // namespace opossum
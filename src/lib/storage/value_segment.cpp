@@ -13,6 +13,9 @@
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T> values) : _values(std::move(values)) {}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
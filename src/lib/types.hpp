@@ -53,7 +53,8 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
-using PosList = std::vector<RowID>;
+// Encodings that Table::compress_chunk can apply to the segments of a chunk
+enum class EncodingType { Dictionary, RunLength, FrameOfReference };
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
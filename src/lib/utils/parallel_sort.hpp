@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+
+namespace opossum {
+
+/**
+ * Sorts data by splitting it into partitions of at least min_partition_size elements, sorting them concurrently with
+ * sort_partition (e.g., a std::sort or radix_sort wrapper that takes a std::vector<T>&), and merging the sorted
+ * partitions pairwise with the given comparator. Both steps run as jobs on the TaskScheduler. Small inputs are sorted
+ * on the calling thread.
+ */
+template <typename T, typename SortPartition, typename Comparator>
+void parallel_sort(std::vector<T>& data, const SortPartition& sort_partition, const Comparator& comparator,
+                   const size_t min_partition_size) {
+  const auto max_partition_count = TaskScheduler::get().worker_count();
+  const auto partition_count = std::min(max_partition_count, std::max(size_t{1}, data.size() / min_partition_size));
+
+  if (partition_count == 1) {
+    sort_partition(data);
+    return;
+  }
+
+  // Split the input into partitions and sort them concurrently
+  auto partitions = std::vector<std::vector<T>>(partition_count);
+  const auto partition_size = data.size() / partition_count;
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    const auto begin = data.begin() + partition_id * partition_size;
+    const auto end = partition_id + 1 == partition_count ? data.end() : begin + partition_size;
+    partitions[partition_id].assign(std::make_move_iterator(begin), std::make_move_iterator(end));
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto& partition : partitions) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() { sort_partition(partition); }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  // Merge neighboring partitions until only one is left
+  while (partitions.size() > 1) {
+    auto merged_partitions = std::vector<std::vector<T>>((partitions.size() + 1) / 2);
+    jobs.clear();
+    for (auto merged_id = size_t{0}; merged_id < merged_partitions.size(); ++merged_id) {
+      if (2 * merged_id + 1 == partitions.size()) {
+        merged_partitions[merged_id] = std::move(partitions[2 * merged_id]);
+        continue;
+      }
+      jobs.emplace_back(std::make_shared<JobTask>([&, merged_id]() {
+        auto& left = partitions[2 * merged_id];
+        auto& right = partitions[2 * merged_id + 1];
+        auto& merged = merged_partitions[merged_id];
+        merged.reserve(left.size() + right.size());
+        std::merge(std::make_move_iterator(left.begin()), std::make_move_iterator(left.end()),
+                   std::make_move_iterator(right.begin()), std::make_move_iterator(right.end()),
+                   std::back_inserter(merged), comparator);
+      }));
+    }
+    TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+    partitions = std::move(merged_partitions);
+  }
+
+  data = std::move(partitions.front());
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Sorts pairs of an integral key and a payload by their key using a least-significant-digit radix sort with 8-bit
+ * digits. In contrast to std::sort, this needs O(n) instead of O(n log n) operations and accesses memory sequentially.
+ * Digits in which all keys are equal, e.g., the upper bytes of small integers, are skipped.
+ *
+ * The sort is stable. It needs an additional buffer of the same size as the input.
+ */
+template <typename Key, typename Payload>
+void radix_sort(std::vector<std::pair<Key, Payload>>& data) {
+  static_assert(std::is_integral_v<Key>, "radix_sort can only sort by integral keys");
+  using UnsignedKey = std::make_unsigned_t<Key>;
+
+  constexpr auto DIGIT_BITS = size_t{8};
+  constexpr auto BUCKET_COUNT = size_t{1} << DIGIT_BITS;
+  constexpr auto KEY_BITS = sizeof(Key) * 8;
+
+  // Flipping the sign bit maps signed keys onto unsigned keys with the same order
+  const auto to_unsigned = [](const Key key) {
+    if constexpr (std::is_signed_v<Key>) {
+      return static_cast<UnsignedKey>(static_cast<UnsignedKey>(key) ^ (UnsignedKey{1} << (KEY_BITS - 1)));
+    } else {
+      return static_cast<UnsignedKey>(key);
+    }
+  };
+
+  auto buffer = std::vector<std::pair<Key, Payload>>(data.size());
+
+  for (auto shift = size_t{0}; shift < KEY_BITS; shift += DIGIT_BITS) {
+    auto bucket_offsets = std::array<size_t, BUCKET_COUNT>{};
+    for (const auto& element : data) {
+      ++bucket_offsets[(to_unsigned(element.first) >> shift) & (BUCKET_COUNT - 1)];
+    }
+
+    // All keys share this digit, so this pass would not change the order
+    const auto first_bucket_size = bucket_offsets[(to_unsigned(data.empty() ? Key{} : data[0].first) >> shift) &
+                                                  (BUCKET_COUNT - 1)];
+    if (first_bucket_size == data.size()) continue;
+
+    auto offset = size_t{0};
+    for (auto& bucket_offset : bucket_offsets) {
+      const auto bucket_size = bucket_offset;
+      bucket_offset = offset;
+      offset += bucket_size;
+    }
+
+    for (const auto& element : data) {
+      buffer[bucket_offsets[(to_unsigned(element.first) >> shift) & (BUCKET_COUNT - 1)]++] = element;
+    }
+    data.swap(buffer);
+  }
+}
+
+}  // namespace opossum
@@ -30,6 +30,20 @@ void BaseTest::ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_p
   ASSERT_TABLE_EQ(*tleft, *tright, order_sensitive, strict_types);
 }
 
+std::vector<AllTypeVariant> BaseTest::column_values(const Table& table, const ColumnID column_id) {
+  auto values = std::vector<AllTypeVariant>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    const auto segment = chunk.get_segment(column_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+      values.push_back((*segment)[chunk_offset]);
+    }
+  }
+  return values;
+}
+
 BaseTest::Matrix BaseTest::_table_to_matrix(const Table& table) {
   // initialize matrix with table sizes
   Matrix matrix(table.row_count(), std::vector<AllTypeVariant>(table.column_count()));
@@ -46,6 +46,9 @@ class BaseTest : public ::testing::Test {
   static void ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_ptr<const Table> tright,
                               bool order_sensitive = false, bool strict_types = true);
 
+  // returns the values of a column in the order of the table
+  static std::vector<AllTypeVariant> column_values(const Table& table, const ColumnID column_id);
+
  public:
   virtual ~BaseTest();
 };
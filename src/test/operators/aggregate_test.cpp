@@ -0,0 +1,186 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a: index % 3, b: the string of index % 2, c: index, d: index / 2 as a float
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "long");
+    table->add_column("d", "float");
+    for (auto index = 0; index < 30; ++index) {
+      table->append({index % 3, std::to_string(index % 2), int64_t{index}, index / 2.0f});
+    }
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAggregateTest, AggregateFunctions) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Sum},
+                                             {ColumnID{2}, AggregateFunction::Min},
+                                             {ColumnID{1}, AggregateFunction::Max},
+                                             {ColumnID{3}, AggregateFunction::Avg},
+                                             {std::nullopt, AggregateFunction::Count},
+                                             {ColumnID{3}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto& output = *aggregate->get_output();
+  EXPECT_EQ(output.column_names(),
+            (std::vector<std::string>{"a", "SUM(c)", "MIN(c)", "MAX(b)", "AVG(d)", "COUNT(*)", "SUM(d)"}));
+  EXPECT_EQ(output.column_type(ColumnID{1}), "long");
+  EXPECT_EQ(output.column_type(ColumnID{4}), "double");
+  EXPECT_EQ(output.column_type(ColumnID{6}), "double");
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("SUM(c)", "long");
+  expected->add_column("MIN(c)", "long");
+  expected->add_column("MAX(b)", "string");
+  expected->add_column("AVG(d)", "double");
+  expected->add_column("COUNT(*)", "long");
+  expected->add_column("SUM(d)", "double");
+  expected->append({0, int64_t{135}, int64_t{0}, "1", 6.75, int64_t{10}, 67.5});
+  expected->append({1, int64_t{145}, int64_t{1}, "1", 7.25, int64_t{10}, 72.5});
+  expected->append({2, int64_t{155}, int64_t{2}, "1", 7.75, int64_t{10}, 77.5});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, MultipleGroupByColumns) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Max}},
+      std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("a", "int");
+  expected->add_column("MAX(c)", "long");
+  expected->append({"0", 0, int64_t{24}});
+  expected->append({"1", 1, int64_t{25}});
+  expected->append({"0", 2, int64_t{26}});
+  expected->append({"1", 0, int64_t{27}});
+  expected->append({"0", 1, int64_t{28}});
+  expected->append({"1", 2, int64_t{29}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, WithoutGroupByColumns) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Count},
+                                             {ColumnID{3}, AggregateFunction::Max}},
+      std::vector<ColumnID>{});
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("COUNT(a)", "long");
+  expected->add_column("MAX(d)", "float");
+  expected->append({int64_t{30}, 14.5f});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, GroupByOnly) {
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper, std::vector<AggregateColumnDefinition>{},
+                                               std::vector<ColumnID>{ColumnID{1}});
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->append({"0"});
+  expected->append({"1"});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, AggregateReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpGreaterThanEquals, int64_t{15});
+  scan->execute();
+  auto aggregate = std::make_shared<Aggregate>(
+      scan, std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{1}});
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("SUM(c)", "long");
+  expected->append({"0", int64_t{16 + 18 + 20 + 22 + 24 + 26 + 28}});
+  expected->append({"1", int64_t{15 + 17 + 19 + 21 + 23 + 25 + 27 + 29}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, ManyGroups) {
+  // the groups are merged in multiple partitions
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto index = 0; index < 20'000; ++index) table->append({index % 5'000, index});
+  table->compress_chunk(ChunkID{3});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum},
+                                             {ColumnID{1}, AggregateFunction::Min}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto& output = *aggregate->get_output();
+  EXPECT_GT(output.chunk_count(), 1u);
+  EXPECT_EQ(output.row_count(), 5'000u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto& chunk = output.get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      const auto group = type_cast<int32_t>((*chunk.get_segment(ColumnID{0}))[chunk_offset]);
+      EXPECT_EQ(type_cast<int64_t>((*chunk.get_segment(ColumnID{1}))[chunk_offset]), 4 * group + 30'000);
+      EXPECT_EQ(type_cast<int32_t>((*chunk.get_segment(ColumnID{2}))[chunk_offset]), group);
+    }
+  }
+}
+
+TEST_F(OperatorsAggregateTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 10);
+  scan->execute();
+  auto aggregate = std::make_shared<Aggregate>(
+      scan, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}}, std::vector<ColumnID>{});
+  aggregate->execute();
+
+  const auto& output = *aggregate->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 1u);
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregates) {
+  auto sum_of_strings = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{});
+  EXPECT_THROW(sum_of_strings->execute(), std::logic_error);
+
+  auto min_without_column = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Min}},
+      std::vector<ColumnID>{});
+  EXPECT_THROW(min_without_column->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,158 @@
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a: 0..29 in chunks of 10 with the first one dictionary encoded, b: the string of a % 7
+    auto left = std::make_shared<Table>(10);
+    left->add_column("a", "int");
+    left->add_column("b", "string");
+    for (auto value = 0; value < 30; ++value) left->append({value, std::to_string(value % 7)});
+    left->compress_chunk(ChunkID{0});
+    _left = std::make_shared<TableWrapper>(left);
+    _left->execute();
+
+    // c: the values 0, 3, 6, ... with duplicates, d: the string of c % 5
+    auto right = std::make_shared<Table>(4);
+    right->add_column("c", "int");
+    right->add_column("d", "string");
+    for (auto index = 0; index < 20; ++index) right->append({index / 2 * 3, std::to_string(index / 2 * 3 % 5)});
+    right->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _right = std::make_shared<TableWrapper>(right);
+    _right->execute();
+  }
+
+  // joins the inputs by looking up the rows of the left input in a map of the right one
+  static std::shared_ptr<Table> expected_table(const Table& left, const Table& right, const ColumnID left_column_id,
+                                               const ColumnID right_column_id) {
+    auto expected = std::make_shared<Table>();
+    auto left_columns = std::vector<std::vector<AllTypeVariant>>{};
+    auto right_columns = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto column_id = ColumnID{0}; column_id < left.column_count(); ++column_id) {
+      expected->add_column(left.column_name(column_id), left.column_type(column_id));
+      left_columns.push_back(column_values(left, column_id));
+    }
+    for (auto column_id = ColumnID{0}; column_id < right.column_count(); ++column_id) {
+      expected->add_column(right.column_name(column_id), right.column_type(column_id));
+      right_columns.push_back(column_values(right, column_id));
+    }
+
+    auto right_rows = std::multimap<AllTypeVariant, size_t>{};
+    for (auto right_row = size_t{0}; right_row < right.row_count(); ++right_row) {
+      right_rows.emplace(right_columns[right_column_id][right_row], right_row);
+    }
+
+    for (auto left_row = size_t{0}; left_row < left.row_count(); ++left_row) {
+      const auto [begin, end] = right_rows.equal_range(left_columns[left_column_id][left_row]);
+      for (auto match = begin; match != end; ++match) {
+        auto row = std::vector<AllTypeVariant>{};
+        for (const auto& values : left_columns) row.push_back(values[left_row]);
+        for (const auto& values : right_columns) row.push_back(values[match->second]);
+        expected->append(row);
+      }
+    }
+    return expected;
+  }
+
+  std::shared_ptr<TableWrapper> _left;
+  std::shared_ptr<TableWrapper> _right;
+};
+
+TEST_F(OperatorsJoinHashTest, JoinIntColumns) {
+  auto join = std::make_shared<JoinHash>(_left, _right, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto& output = *join->get_output();
+  EXPECT_EQ(output.column_count(), 4u);
+  EXPECT_EQ(output.column_name(ColumnID{2}), "c");
+  EXPECT_EQ(output.row_count(), 20u);
+  EXPECT_TABLE_EQ(output, *expected_table(*_left->get_output(), *_right->get_output(), ColumnID{0}, ColumnID{0}));
+}
+
+TEST_F(OperatorsJoinHashTest, JoinStringColumnsWithDuplicates) {
+  auto join = std::make_shared<JoinHash>(_left, _right, std::make_pair(ColumnID{1}, ColumnID{1}));
+  join->execute();
+
+  EXPECT_TABLE_EQ(join->get_output(),
+                  expected_table(*_left->get_output(), *_right->get_output(), ColumnID{1}, ColumnID{1}));
+}
+
+TEST_F(OperatorsJoinHashTest, JoinReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_left, ColumnID{0}, ScanType::OpGreaterThanEquals, 12);
+  scan->execute();
+  auto join = std::make_shared<JoinHash>(_right, scan, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto& output = *join->get_output();
+  EXPECT_TABLE_EQ(output, *expected_table(*_right->get_output(), *scan->get_output(), ColumnID{0}, ColumnID{0}));
+
+  // the output references the data tables
+  const auto segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(output.get_chunk(ChunkID{0}).get_segment(ColumnID{2}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->referenced_table(), _left->get_output());
+}
+
+TEST_F(OperatorsJoinHashTest, EmptyResult) {
+  auto scan = std::make_shared<TableScan>(_left, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+  auto join = std::make_shared<JoinHash>(scan, _right, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto& output = *join->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 4u);
+}
+
+TEST_F(OperatorsJoinHashTest, MismatchingTypes) {
+  auto join = std::make_shared<JoinHash>(_left, _right, std::make_pair(ColumnID{0}, ColumnID{1}));
+  EXPECT_THROW(join->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsJoinHashTest, RadixBits) {
+  const auto worker_bits = JoinHash::radix_bits(0, 16);
+  EXPECT_GE(size_t{1} << worker_bits, TaskScheduler::get().worker_count());
+
+  // partitions of the build side fit into the cache
+  const auto row_count = 64 * JoinHash::CACHE_SIZE;
+  const auto radix_bits = JoinHash::radix_bits(row_count, 16);
+  EXPECT_LE(row_count * 16 >> radix_bits, JoinHash::CACHE_SIZE);
+  EXPECT_LE(JoinHash::radix_bits(size_t{1} << 40, 16), JoinHash::MAX_RADIX_BITS);
+}
+
+TEST_F(OperatorsJoinHashTest, JoinManyPartitions) {
+  // the build side does not fit into the cache, so it is split into multiple partitions
+  auto left = std::make_shared<Table>(1000);
+  left->add_column("a", "long");
+  auto right = std::make_shared<Table>(700);
+  right->add_column("b", "double");
+  right->add_column("c", "long");
+  for (auto index = int64_t{0}; index < 40'000; ++index) left->append({index * 7 % 30'011});
+  for (auto index = int64_t{0}; index < 30'000; ++index) right->append({index * 0.5, index * 2});
+  auto left_wrapper = std::make_shared<TableWrapper>(left);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+
+  ASSERT_GT(JoinHash::radix_bits(right->row_count(), 24), 0u);
+  auto join = std::make_shared<JoinHash>(left_wrapper, right_wrapper, std::make_pair(ColumnID{0}, ColumnID{1}));
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(), expected_table(*left, *right, ColumnID{0}, ColumnID{1}));
+}
+
+}  // namespace opossum
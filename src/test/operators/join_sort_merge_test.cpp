@@ -0,0 +1,178 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSortMergeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto left = std::make_shared<Table>(10);
+    left->add_column("a", "int");
+    left->add_column("b", "string");
+    for (auto index = 0; index < 30; ++index) left->append({index * 7 % 23, std::to_string(index % 9)});
+    left->compress_chunk(ChunkID{0});
+    _left = std::make_shared<TableWrapper>(left);
+    _left->execute();
+
+    auto right = std::make_shared<Table>(4);
+    right->add_column("c", "int");
+    right->add_column("d", "string");
+    for (auto index = 0; index < 20; ++index) right->append({index / 2 * 3, std::to_string(index % 5)});
+    right->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _right = std::make_shared<TableWrapper>(right);
+    _right->execute();
+  }
+
+  // joins the inputs with nested loops
+  static std::shared_ptr<Table> expected_table(const Table& left, const Table& right, const ColumnID left_column_id,
+                                               const ColumnID right_column_id, const ScanType scan_type) {
+    auto expected = std::make_shared<Table>();
+    for (const auto& input : {&left, &right}) {
+      for (auto column_id = ColumnID{0}; column_id < input->column_count(); ++column_id) {
+        expected->add_column(input->column_name(column_id), input->column_type(column_id));
+      }
+    }
+
+    const auto right_rows = rows(right);
+    for (const auto& left_row : rows(left)) {
+      for (const auto& right_row : right_rows) {
+        const auto& left_value = left_row[left_column_id];
+        const auto& right_value = right_row[right_column_id];
+        auto match = false;
+        switch (scan_type) {
+          case ScanType::OpEquals:
+            match = left_value == right_value;
+            break;
+          case ScanType::OpNotEquals:
+            match = left_value != right_value;
+            break;
+          case ScanType::OpLessThan:
+            match = left_value < right_value;
+            break;
+          case ScanType::OpLessThanEquals:
+            match = left_value <= right_value;
+            break;
+          case ScanType::OpGreaterThan:
+            match = left_value > right_value;
+            break;
+          case ScanType::OpGreaterThanEquals:
+            match = left_value >= right_value;
+            break;
+        }
+        if (!match) continue;
+
+        auto row = left_row;
+        row.insert(row.end(), right_row.cbegin(), right_row.cend());
+        expected->append(row);
+      }
+    }
+    return expected;
+  }
+
+  static std::vector<std::vector<AllTypeVariant>> rows(const Table& table) {
+    auto rows = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        auto row = std::vector<AllTypeVariant>{};
+        for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+          row.push_back((*chunk.get_segment(column_id))[chunk_offset]);
+        }
+        rows.push_back(std::move(row));
+      }
+    }
+    return rows;
+  }
+
+  void test_join(const std::shared_ptr<const AbstractOperator>& left,
+                 const std::shared_ptr<const AbstractOperator>& right,
+                 const std::pair<ColumnID, ColumnID>& column_ids) {
+    for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                                 ScanType::OpLessThanEquals, ScanType::OpGreaterThan,
+                                 ScanType::OpGreaterThanEquals}) {
+      auto join = std::make_shared<JoinSortMerge>(left, right, column_ids, scan_type);
+      join->execute();
+      EXPECT_TABLE_EQ(join->get_output(), expected_table(*left->get_output(), *right->get_output(), column_ids.first,
+                                                         column_ids.second, scan_type));
+    }
+  }
+
+  std::shared_ptr<TableWrapper> _left;
+  std::shared_ptr<TableWrapper> _right;
+};
+
+TEST_F(OperatorsJoinSortMergeTest, JoinIntColumns) { test_join(_left, _right, {ColumnID{0}, ColumnID{0}}); }
+
+TEST_F(OperatorsJoinSortMergeTest, JoinStringColumns) { test_join(_left, _right, {ColumnID{1}, ColumnID{1}}); }
+
+TEST_F(OperatorsJoinSortMergeTest, JoinReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_left, ColumnID{0}, ScanType::OpGreaterThanEquals, 12);
+  scan->execute();
+  test_join(_right, scan, {ColumnID{0}, ColumnID{0}});
+}
+
+TEST_F(OperatorsJoinSortMergeTest, JoinManyPartitions) {
+  // the left input is sorted and the right one is clustered, i.e., sorted within chunks
+  auto left = std::make_shared<Table>(1000);
+  left->add_column("a", "long");
+  for (auto index = int64_t{0}; index < 30'000; ++index) left->append({index / 4});
+  auto right = std::make_shared<Table>(100);
+  right->add_column("b", "long");
+  for (auto index = int64_t{0}; index < 1'000; ++index) right->append({(9 - index / 100) * 750 + index % 100});
+  auto left_wrapper = std::make_shared<TableWrapper>(left);
+  left_wrapper->execute();
+  auto right_wrapper = std::make_shared<TableWrapper>(right);
+  right_wrapper->execute();
+
+  auto join = std::make_shared<JoinSortMerge>(left_wrapper, right_wrapper, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                              ScanType::OpEquals);
+  join->execute();
+
+  // each right value occurs four times on the left
+  const auto& output = *join->get_output();
+  EXPECT_EQ(output.row_count(), 4'000u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output.chunk_count(); ++chunk_id) {
+    const auto& chunk = output.get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      EXPECT_EQ((*chunk.get_segment(ColumnID{0}))[chunk_offset], (*chunk.get_segment(ColumnID{1}))[chunk_offset]);
+    }
+  }
+
+  auto scan = std::make_shared<TableScan>(left_wrapper, ColumnID{0}, ScanType::OpLessThan, int64_t{100});
+  scan->execute();
+  join = std::make_shared<JoinSortMerge>(right_wrapper, scan, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                         ScanType::OpGreaterThan);
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 379'800u);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, EmptyResult) {
+  auto scan = std::make_shared<TableScan>(_left, ColumnID{0}, ScanType::OpLessThan, 0);
+  scan->execute();
+  auto join =
+      std::make_shared<JoinSortMerge>(scan, _right, std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpLessThan);
+  join->execute();
+
+  const auto& output = *join->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 4u);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, MismatchingTypes) {
+  auto join = std::make_shared<JoinSortMerge>(_left, _right, std::make_pair(ColumnID{0}, ColumnID{1}),
+                                              ScanType::OpEquals);
+  EXPECT_THROW(join->execute(), std::logic_error);
+}
+
+}  // namespace opossum
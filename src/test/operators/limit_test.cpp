@@ -0,0 +1,97 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsLimitTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(10);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto index = 0; index < 35; ++index) _table->append({index, std::to_string(index % 4)});
+    _table->compress_chunk(ChunkID{1});
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsLimitTest, PrefixAcrossChunks) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 14);
+  limit->execute();
+
+  const auto& output = *limit->get_output();
+  EXPECT_EQ(output.chunk_count(), 2u);
+  auto expected_a = std::vector<AllTypeVariant>{};
+  auto expected_b = std::vector<AllTypeVariant>{};
+  for (auto index = 0; index < 14; ++index) {
+    expected_a.emplace_back(index);
+    expected_b.emplace_back(std::to_string(index % 4));
+  }
+  EXPECT_EQ(column_values(output, ColumnID{0}), expected_a);
+  EXPECT_EQ(column_values(output, ColumnID{1}), expected_b);
+
+  // the first chunk is referenced as a whole, the columns of the second one share a position list
+  const auto first_segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(output.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_NE(first_segment, nullptr);
+  EXPECT_TRUE(first_segment->pos_list()->is_entire_chunk());
+  const auto& second_chunk = output.get_chunk(ChunkID{1});
+  const auto second_segment = std::dynamic_pointer_cast<ReferenceSegment>(second_chunk.get_segment(ColumnID{0}));
+  ASSERT_NE(second_segment, nullptr);
+  EXPECT_FALSE(second_segment->pos_list()->is_entire_chunk());
+  EXPECT_EQ(second_segment->pos_list(),
+            std::dynamic_pointer_cast<ReferenceSegment>(second_chunk.get_segment(ColumnID{1}))->pos_list());
+}
+
+TEST_F(OperatorsLimitTest, RowCountExceedsInput) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 100);
+  limit->execute();
+  EXPECT_TABLE_EQ(limit->get_output(), _table);
+}
+
+TEST_F(OperatorsLimitTest, RowCountIsZero) {
+  auto limit = std::make_shared<Limit>(_table_wrapper, 0);
+  limit->execute();
+
+  const auto& output = *limit->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+TEST_F(OperatorsLimitTest, ReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 7);
+  scan->execute();
+  auto second_scan = std::make_shared<TableScan>(scan, ColumnID{1}, ScanType::OpNotEquals, "2");
+  second_scan->execute();
+
+  for (const auto& in : std::vector<std::shared_ptr<TableScan>>{scan, second_scan}) {
+    auto limit = std::make_shared<Limit>(in, 6);
+    limit->execute();
+
+    auto expected = column_values(*in->get_output(), ColumnID{0});
+    expected.resize(6);
+    EXPECT_EQ(column_values(*limit->get_output(), ColumnID{0}), expected);
+
+    // the output references the data table
+    const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(
+        limit->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{1}));
+    ASSERT_NE(segment, nullptr);
+    EXPECT_EQ(segment->referenced_table(), _table);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,126 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/materialize.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class OperatorsMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(10);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "double");
+    for (auto value = 0; value < 40; ++value) _table->append({value, std::to_string(value), value * 0.5});
+    _table->compress_chunk(ChunkID{0});
+    _table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+  }
+
+  // returns the values of a column and checks that no segment is a ReferenceSegment
+  static std::vector<AllTypeVariant> materialized_values(const Table& table, const ColumnID column_id) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      EXPECT_EQ(std::dynamic_pointer_cast<ReferenceSegment>(table.get_chunk(chunk_id).get_segment(column_id)), nullptr);
+    }
+    return column_values(table, column_id);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsMaterializeTest, MaterializesScanResult) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 15);
+  scan->execute();
+  auto materialize = std::make_shared<Materialize>(scan);
+  materialize->execute();
+
+  const auto& output = *materialize->get_output();
+  EXPECT_EQ(output.column_count(), 3u);
+  EXPECT_EQ(output.column_name(ColumnID{1}), "b");
+  EXPECT_EQ(output.column_type(ColumnID{2}), "double");
+  EXPECT_EQ(output.row_count(), 25u);
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<std::string>>(output.get_chunk(ChunkID{0}).get_segment(ColumnID{1})),
+            nullptr);
+
+  auto expected = std::vector<AllTypeVariant>{};
+  for (auto value = 15; value < 40; ++value) expected.emplace_back(std::to_string(value));
+  EXPECT_EQ(materialized_values(output, ColumnID{1}), expected);
+}
+
+TEST_F(OperatorsMaterializeTest, MaterializesRequestedColumns) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto materialize = std::make_shared<Materialize>(table_wrapper, std::vector<ColumnID>{ColumnID{2}, ColumnID{0}});
+  materialize->execute();
+
+  const auto& output = *materialize->get_output();
+  EXPECT_EQ(output.column_count(), 2u);
+  EXPECT_EQ(output.column_name(ColumnID{0}), "c");
+  EXPECT_EQ(output.column_name(ColumnID{1}), "a");
+  EXPECT_EQ(output.chunk_count(), 4u);
+
+  auto expected = std::vector<AllTypeVariant>{};
+  for (auto value = 0; value < 40; ++value) expected.emplace_back(value);
+  EXPECT_EQ(materialized_values(output, ColumnID{1}), expected);
+
+  auto invalid = std::make_shared<Materialize>(table_wrapper, std::vector<ColumnID>{ColumnID{3}});
+  EXPECT_THROW(invalid->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsMaterializeTest, GathersRandomPositionsInOrder) {
+  // the positions alternate between the chunks and are not sorted, so they are gathered with prefetching
+  auto pos_list = std::make_shared<PosList>();
+  for (auto index = ChunkOffset{40}; index > 0; --index) {
+    pos_list->push_back(RowID{ChunkID{(index - 1) % 4}, (index - 1) / 4});
+  }
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", "int");
+  reference_table->add_column_definition("b", "string");
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{0}, pos_list));
+  chunk.add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{1}, pos_list));
+  reference_table->emplace_chunk(std::move(chunk));
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto materialize = std::make_shared<Materialize>(table_wrapper);
+  materialize->execute();
+
+  auto expected_a = std::vector<AllTypeVariant>{};
+  auto expected_b = std::vector<AllTypeVariant>{};
+  for (auto index = 40; index > 0; --index) {
+    const auto value = (index - 1) % 4 * 10 + (index - 1) / 4;
+    expected_a.emplace_back(value);
+    expected_b.emplace_back(std::to_string(value));
+  }
+  EXPECT_EQ(materialized_values(*materialize->get_output(), ColumnID{0}), expected_a);
+  EXPECT_EQ(materialized_values(*materialize->get_output(), ColumnID{1}), expected_b);
+}
+
+TEST_F(OperatorsMaterializeTest, EmptyInput) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, -1);
+  scan->execute();
+  auto materialize = std::make_shared<Materialize>(scan);
+  materialize->execute();
+
+  const auto& output = *materialize->get_output();
+  EXPECT_EQ(output.column_count(), 3u);
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.chunk_count(), 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a: index % 100, b: the string of index % 7, c: index
+    _table = std::make_shared<Table>(1'000);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "long");
+    for (auto index = 0; index < 5'500; ++index) {
+      _table->append({index % 100, std::to_string(index % 7), int64_t{index}});
+    }
+    _table->compress_chunk(ChunkID{0});
+    _table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // returns a scan of the input that selects most of its rows, and a scan of its output that selects fewer
+  static std::shared_ptr<TableScan> scans(const std::shared_ptr<const AbstractOperator>& in) {
+    auto scan = std::make_shared<TableScan>(in, ColumnID{0}, ScanType::OpGreaterThanEquals, 10);
+    return std::make_shared<TableScan>(scan, ColumnID{1}, ScanType::OpNotEquals, "3");
+  }
+
+  // executes the operators below and including the root one after the other
+  static void execute_all(const std::shared_ptr<AbstractOperator>& root) {
+    if (const auto input = std::const_pointer_cast<AbstractOperator>(root->input_left())) {
+      if (!input->get_output()) execute_all(input);
+    }
+    root->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPipelineTest, FusesScans) {
+  const auto second_scan = scans(_table_wrapper);
+  auto pipeline = std::make_shared<Pipeline>(second_scan);
+  EXPECT_EQ(pipeline->input_left(), _table_wrapper);
+  ASSERT_EQ(pipeline->stages().size(), 2u);
+  EXPECT_EQ(pipeline->stages().front(), second_scan->input_left());
+  EXPECT_EQ(pipeline->stages().back(), second_scan);
+  EXPECT_EQ(pipeline->sink(), nullptr);
+  pipeline->execute();
+
+  // the chunks are in the order of the input and reference the data table
+  execute_all(second_scan);
+  EXPECT_TABLE_EQ(pipeline->get_output(), second_scan->get_output(), true);
+  const auto& output = *pipeline->get_output();
+  EXPECT_EQ(output.chunk_count(), _table->chunk_count());
+  const auto segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(output.get_chunk(ChunkID{0}).get_segment(ColumnID{2}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->referenced_table(), _table);
+}
+
+TEST_F(OperatorsPipelineTest, EndsWithAggregate) {
+  auto aggregate = std::make_shared<Aggregate>(
+      scans(_table_wrapper),
+      std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Sum},
+                                             {std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{1}});
+  auto pipeline = std::make_shared<Pipeline>(aggregate);
+  EXPECT_EQ(pipeline->stages().size(), 2u);
+  EXPECT_EQ(pipeline->sink(), aggregate);
+  pipeline->execute();
+
+  execute_all(aggregate);
+  EXPECT_TABLE_EQ(pipeline->get_output(), aggregate->get_output());
+  EXPECT_EQ(pipeline->get_output()->row_count(), 6u);
+}
+
+TEST_F(OperatorsPipelineTest, AggregateWithoutStages) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Max}},
+      std::vector<ColumnID>{});
+  auto pipeline = std::make_shared<Pipeline>(aggregate);
+  EXPECT_TRUE(pipeline->stages().empty());
+  pipeline->execute();
+
+  execute_all(aggregate);
+  EXPECT_TABLE_EQ(pipeline->get_output(), aggregate->get_output());
+}
+
+TEST_F(OperatorsPipelineTest, StartsAfterPipelineBreaker) {
+  auto sort = std::make_shared<Sort>(_table_wrapper,
+                                     std::vector<SortColumnDefinition>{{ColumnID{2}, OrderByMode::Descending}});
+  sort->execute();
+  const auto second_scan = scans(sort);
+  auto pipeline = std::make_shared<Pipeline>(second_scan);
+  EXPECT_EQ(pipeline->input_left(), sort);
+  pipeline->execute();
+
+  execute_all(second_scan);
+  EXPECT_TABLE_EQ(pipeline->get_output(), second_scan->get_output(), true);
+}
+
+TEST_F(OperatorsPipelineTest, EmptyOutput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1'000);
+  auto pipeline = std::make_shared<Pipeline>(std::make_shared<TableScan>(scan, ColumnID{2}, ScanType::OpLessThan, 5));
+  pipeline->execute();
+
+  const auto& output = *pipeline->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 3u);
+}
+
+TEST_F(OperatorsPipelineTest, RootHasToStreamOrSink) {
+  auto sort = std::make_shared<Sort>(scans(_table_wrapper), std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  EXPECT_THROW(std::make_shared<Pipeline>(sort), std::logic_error);
+}
+
+}  // namespace opossum
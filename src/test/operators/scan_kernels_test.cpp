@@ -0,0 +1,128 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/scan_kernels.hpp"
+
+namespace opossum {
+
+class OperatorsScanKernelsTest : public BaseTest {
+ protected:
+  // all instruction sets that can be tested on this CPU
+  static std::vector<SimdLevel> simd_levels() {
+    auto simd_levels = std::vector<SimdLevel>{SimdLevel::Scalar};
+    if (supported_simd_level() >= SimdLevel::AVX2) simd_levels.push_back(SimdLevel::AVX2);
+    if (supported_simd_level() >= SimdLevel::AVX512) simd_levels.push_back(SimdLevel::AVX512);
+    return simd_levels;
+  }
+
+  template <typename T>
+  static std::vector<ChunkOffset> expected_matches(const std::vector<T>& values, const ScanType scan_type,
+                                                   const T search_value, const ChunkOffset base) {
+    auto matches = std::vector<ChunkOffset>{};
+    for (auto index = ChunkOffset{0}; index < values.size(); ++index) {
+      const auto& value = values[index];
+      auto match = false;
+      switch (scan_type) {
+        case ScanType::OpEquals:
+          match = value == search_value;
+          break;
+        case ScanType::OpNotEquals:
+          match = value != search_value;
+          break;
+        case ScanType::OpLessThan:
+          match = value < search_value;
+          break;
+        case ScanType::OpLessThanEquals:
+          match = value <= search_value;
+          break;
+        case ScanType::OpGreaterThan:
+          match = value > search_value;
+          break;
+        case ScanType::OpGreaterThanEquals:
+          match = value >= search_value;
+          break;
+      }
+      if (match) matches.push_back(base + index);
+    }
+    return matches;
+  }
+
+  template <typename T>
+  void test_scan_values(std::vector<T> values) {
+    // the last vector is incomplete and has to be scanned by the scalar remainder
+    values.resize(values.size() - 3);
+
+    for (const auto scan_type : scan_types) {
+      for (const auto search_value : {T{-1}, T{7}, T{50}, std::numeric_limits<T>::max()}) {
+        const auto expected = expected_matches(values, scan_type, search_value, 100);
+        for (const auto simd_level : simd_levels()) {
+          auto matches = std::vector<ChunkOffset>{};
+          scan_values(values.data(), values.size(), scan_type, search_value, 100, matches, simd_level);
+          EXPECT_EQ(matches, expected);
+        }
+      }
+    }
+  }
+
+  template <typename Code>
+  void test_scan_code_range() {
+    auto codes = std::vector<Code>(1000);
+    for (auto index = size_t{0}; index < codes.size(); ++index) codes[index] = static_cast<Code>(index * 7 % 251);
+    codes[3] = std::numeric_limits<Code>::max();
+
+    for (const auto& [begin, width] : std::vector<std::pair<Code, Code>>{{0, 0}, {0, 1}, {10, 100}, {200, 51}}) {
+      for (const auto negated : {false, true}) {
+        auto expected = std::vector<ChunkOffset>{};
+        for (auto index = ChunkOffset{0}; index < codes.size(); ++index) {
+          if ((codes[index] >= begin && codes[index] < begin + width) != negated) expected.push_back(index + 5);
+        }
+
+        for (const auto simd_level : simd_levels()) {
+          auto matches = std::vector<ChunkOffset>{};
+          scan_code_range(codes.data(), codes.size(), begin, width, negated, 5, matches, simd_level);
+          EXPECT_EQ(matches, expected);
+        }
+      }
+    }
+  }
+
+  template <typename T>
+  static std::vector<T> random_values() {
+    auto values = std::vector<T>(1000);
+    auto generator = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int>{-10, 100};
+    for (auto& value : values) value = static_cast<T>(distribution(generator));
+    return values;
+  }
+
+  const std::vector<ScanType> scan_types{ScanType::OpEquals,         ScanType::OpNotEquals,
+                                         ScanType::OpLessThan,       ScanType::OpLessThanEquals,
+                                         ScanType::OpGreaterThan,    ScanType::OpGreaterThanEquals};
+};
+
+TEST_F(OperatorsScanKernelsTest, ScanValues) {
+  test_scan_values(random_values<int32_t>());
+  test_scan_values(random_values<int64_t>());
+  test_scan_values(random_values<float>());
+  test_scan_values(random_values<double>());
+}
+
+TEST_F(OperatorsScanKernelsTest, ScanValuesWithNaN) {
+  auto values = random_values<double>();
+  values[17] = std::nan("");
+  test_scan_values(values);
+}
+
+TEST_F(OperatorsScanKernelsTest, ScanCodeRange) {
+  test_scan_code_range<uint8_t>();
+  test_scan_code_range<uint16_t>();
+  test_scan_code_range<uint32_t>();
+}
+
+}  // namespace opossum
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a: index * 7 % 10, b: the string of index % 4, c: index, d: index % 3 as a double
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "long");
+    table->add_column("d", "double");
+    for (auto index = 0; index < 35; ++index) {
+      table->append({index * 7 % 10, std::to_string(index % 4), int64_t{index}, index % 3 * 1.0});
+    }
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsSortTest, SortByIntColumn) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  sort->execute();
+
+  const auto& output = *sort->get_output();
+  EXPECT_EQ(output.row_count(), 35u);
+  EXPECT_NE(std::dynamic_pointer_cast<ReferenceSegment>(output.get_chunk(ChunkID{0}).get_segment(ColumnID{0})),
+            nullptr);
+
+  // rows with equal values keep their order
+  auto expected_a = std::vector<AllTypeVariant>{};
+  auto expected_c = std::vector<AllTypeVariant>{};
+  for (auto value = 0; value < 10; ++value) {
+    for (auto index = 0; index < 35; ++index) {
+      if (index * 7 % 10 != value) continue;
+      expected_a.emplace_back(value);
+      expected_c.emplace_back(int64_t{index});
+    }
+  }
+  EXPECT_EQ(column_values(output, ColumnID{0}), expected_a);
+  EXPECT_EQ(column_values(output, ColumnID{2}), expected_c);
+}
+
+TEST_F(OperatorsSortTest, SortByMultipleColumns) {
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}, OrderByMode::Descending},
+                                                        {ColumnID{3}, OrderByMode::Ascending},
+                                                        {ColumnID{2}, OrderByMode::Descending}});
+  sort->execute();
+
+  auto expected = std::vector<AllTypeVariant>{};
+  for (auto b = 3; b >= 0; --b) {
+    for (auto d = 0; d < 3; ++d) {
+      for (auto index = 34; index >= 0; --index) {
+        if (index % 4 == b && index % 3 == d) expected.emplace_back(int64_t{index});
+      }
+    }
+  }
+  EXPECT_EQ(column_values(*sort->get_output(), ColumnID{2}), expected);
+}
+
+TEST_F(OperatorsSortTest, SortDescendingByDictionaryColumn) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto index = 0; index < 1000; ++index) table->append({index % 97 - 50, "s" + std::to_string(index % 89)});
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) table->compress_chunk(chunk_id);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto& column_id : {ColumnID{0}, ColumnID{1}}) {
+    auto sort = std::make_shared<Sort>(table_wrapper,
+                                       std::vector<SortColumnDefinition>{{column_id, OrderByMode::Descending}});
+    sort->execute();
+
+    auto expected = column_values(*table, column_id);
+    std::stable_sort(expected.begin(), expected.end(), std::greater<>{});
+    EXPECT_EQ(column_values(*sort->get_output(), column_id), expected);
+  }
+}
+
+TEST_F(OperatorsSortTest, SortReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpGreaterThanEquals, int64_t{12});
+  scan->execute();
+  auto sort = std::make_shared<Sort>(scan, std::vector<SortColumnDefinition>{{ColumnID{2}, OrderByMode::Descending}});
+  sort->execute();
+
+  auto expected = std::vector<AllTypeVariant>{};
+  for (auto index = int64_t{34}; index >= 12; --index) expected.emplace_back(index);
+  const auto& output = *sort->get_output();
+  EXPECT_EQ(column_values(output, ColumnID{2}), expected);
+
+  // the output references the data table
+  const auto segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(output.get_chunk(ChunkID{0}).get_segment(ColumnID{1}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsSortTest, SplitsOutputIntoChunks) {
+  auto table = std::make_shared<Table>(50'000);
+  table->add_column("a", "float");
+  for (auto index = 0; index < 100'000; ++index) table->append({static_cast<float>(index % 1'000)});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  sort->execute();
+
+  const auto& output = *sort->get_output();
+  EXPECT_EQ(output.chunk_count(), 2u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).size(), Sort::OUTPUT_CHUNK_SIZE);
+  const auto values = column_values(output, ColumnID{0});
+  EXPECT_TRUE(std::is_sorted(values.cbegin(), values.cend()));
+}
+
+TEST_F(OperatorsSortTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+  auto sort = std::make_shared<Sort>(scan, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  sort->execute();
+
+  const auto& output = *sort->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 4u);
+}
+
+}  // namespace opossum
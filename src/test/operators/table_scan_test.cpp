@@ -14,257 +14,495 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_statistics.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
 
-// class OperatorsTableScanTest : public BaseTest {
-//  protected:
-//   void SetUp() override {
-//     _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
-//     _table_wrapper->execute();
+class OperatorsTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->execute();
 
-//     std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
-//     test_even_dict->add_column("a", "int");
-//     test_even_dict->add_column("b", "int");
-//     for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
+    std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
+    test_even_dict->add_column("a", "int");
+    test_even_dict->add_column("b", "int");
+    for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
 
-//     test_even_dict->compress_chunk(ChunkID(0));
-//     test_even_dict->compress_chunk(ChunkID(1));
+    test_even_dict->compress_chunk(ChunkID(0));
+    test_even_dict->compress_chunk(ChunkID(1));
 
-//     _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
-//     _table_wrapper_even_dict->execute();
-//   }
+    _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
+    _table_wrapper_even_dict->execute();
+  }
 
-//   std::shared_ptr<TableWrapper> get_table_op_part_dict() {
-//     auto table = std::make_shared<Table>(5);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
+  std::shared_ptr<TableWrapper> get_table_op_part_dict() {
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
 
-//     for (int i = 1; i < 20; ++i) {
-//       table->append({i, 100.1 + i});
-//     }
+    for (int i = 1; i < 20; ++i) {
+      table->append({i, 100.1 + i});
+    }
 
-//     table->compress_chunk(ChunkID(0));
-//     table->compress_chunk(ChunkID(1));
+    table->compress_chunk(ChunkID(0));
+    table->compress_chunk(ChunkID(1));
 
-//     auto table_wrapper = std::make_shared<TableWrapper>(table);
-//     table_wrapper->execute();
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
 
-//     return table_wrapper;
-//   }
+    return table_wrapper;
+  }
 
-//   std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
-//     // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
-//     auto table = std::make_shared<opossum::Table>(0);
-//     table->add_column("a", "int");
-//     table->add_column("b", "float");
+  std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
+    // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
+    auto table = std::make_shared<opossum::Table>(0);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
 
-//     for (int i = 0; i <= num_entries; i++) {
-//       table->append({i, 100.0f + i});
-//     }
+    for (int i = 0; i <= num_entries; i++) {
+      table->append({i, 100.0f + i});
+    }
 
-//     table->compress_chunk(ChunkID(0));
-
-//     auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
-//     table_wrapper->execute();
-//     return table_wrapper;
-//   }
+    table->compress_chunk(ChunkID(0));
+
+    auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
 
-//   void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
-//                         std::vector<AllTypeVariant> expected) {
-//     for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
-//       const auto& chunk = table->get_chunk(chunk_id);
+  void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
+                        std::vector<AllTypeVariant> expected) {
+    for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
 
-//       for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
-//         const auto& segment = *chunk.get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
+        const auto& segment = *chunk.get_segment(column_id);
 
-//         const auto found_value = segment[chunk_offset];
-//         const auto comparator = [found_value](const AllTypeVariant expected_value) {
-//           // returns equivalency, not equality to simulate std::multiset.
-//           // multiset cannot be used because it triggers a compiler / lib bug when built in CI
-//           return !(found_value < expected_value) && !(expected_value < found_value);
-//         };
-
-//         auto search = std::find_if(expected.begin(), expected.end(), comparator);
-
-//         ASSERT_TRUE(search != expected.end());
-//         expected.erase(search);
-//       }
-//     }
-
-//     ASSERT_EQ(expected.size(), 0u);
-//   }
-
-//   std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
-// };
-
-// TEST_F(OperatorsTableScanTest, DoubleScan) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
-
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan_1->execute();
-
-//   auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
-//   scan_2->execute();
-
-//   EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, EmptyResultScan) {
-//   auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
-//   scan_1->execute();
-
-//   for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
-//     EXPECT_EQ(scan_1->get_output()->get_chunk(i).column_count(), 2u);
-// }
-
-// TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
-
-//   auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
-//   scan->execute();
-
-//   EXPECT_TABLE_EQ(scan->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
-//   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {104};
-//   tests[ScanType::OpNotEquals] = {100, 102, 106};
-//   tests[ScanType::OpLessThan] = {100, 102};
-//   tests[ScanType::OpLessThanEquals] = {100, 102, 104};
-//   tests[ScanType::OpGreaterThan] = {106};
-//   tests[ScanType::OpGreaterThanEquals] = {104, 106};
-//   for (const auto& test : tests) {
-//     auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
-//     scan1->execute();
-
-//     auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
-//     scan2->execute();
-
-//     ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
-//   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
-
-//   auto table_wrapper = get_table_op_part_dict();
-//   auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
-//   scan_1->execute();
-
-//   EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = all_rows;
-//   tests[ScanType::OpLessThanEquals] = all_rows;
-//   tests[ScanType::OpGreaterThan] = no_rows;
-//   tests[ScanType::OpGreaterThanEquals] = no_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
-//   const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   const auto no_rows = std::vector<AllTypeVariant>{};
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = no_rows;
-//   tests[ScanType::OpNotEquals] = all_rows;
-//   tests[ScanType::OpLessThan] = no_rows;
-//   tests[ScanType::OpLessThanEquals] = no_rows;
-//   tests[ScanType::OpGreaterThan] = all_rows;
-//   tests[ScanType::OpGreaterThanEquals] = all_rows;
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
-//   // scanning for a value that is around the dictionary's bounds
-
-//   std::map<ScanType, std::vector<AllTypeVariant>> tests;
-//   tests[ScanType::OpEquals] = {100};
-//   tests[ScanType::OpLessThan] = {};
-//   tests[ScanType::OpLessThanEquals] = {100};
-//   tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-//   tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
-
-//   for (const auto& test : tests) {
-//     auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
-//     scan->execute();
-
-//     ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
-//   }
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
-//   auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
-//   scan_1->execute();
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
-
-//   // scan_1 produced an empty result
-//   auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
-// }
-
-// TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
-//   // 2**8 + 1 values require a data type of 16bit.
-//   const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
-//   auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
-//   scan_1->execute();
-
-//   EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
-
-//   // 2**16 + 1 values require a data type of 32bit.
-//   const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
-//   auto scan_2 =
-//       std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
-//   scan_2->execute();
-
-//   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
-// }
+        const auto found_value = segment[chunk_offset];
+        const auto comparator = [found_value](const AllTypeVariant expected_value) {
+          // returns equivalency, not equality to simulate std::multiset.
+          // multiset cannot be used because it triggers a compiler / lib bug when built in CI
+          return !(found_value < expected_value) && !(expected_value < found_value);
+        };
+
+        auto search = std::find_if(expected.begin(), expected.end(), comparator);
+
+        ASSERT_TRUE(search != expected.end());
+        expected.erase(search);
+      }
+    }
+
+    ASSERT_EQ(expected.size(), 0u);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_even_dict;
+};
+
+TEST_F(OperatorsTableScanTest, DoubleScan) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan_1->execute();
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 457.9);
+  scan_2->execute();
+
+  EXPECT_TABLE_EQ(scan_2->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, EmptyResultScan) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 90000);
+  scan_1->execute();
+
+  for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
+    EXPECT_EQ(scan_1->get_output()->get_chunk(i).column_count(), 2u);
+}
+
+TEST_F(OperatorsTableScanTest, SingleScanReturnsCorrectRowCount) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_filtered2.tbl", 1);
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 1234);
+  scan->execute();
+
+  EXPECT_TABLE_EQ(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 4);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnReferencedDictColumn) {
+  // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106};
+  for (const auto& test : tests) {
+    auto scan1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{1}, ScanType::OpLessThan, 108);
+    scan1->execute();
+
+    auto scan2 = std::make_shared<TableScan>(scan1, ColumnID{0}, test.first, 4);
+    scan2->execute();
+
+    ASSERT_COLUMN_EQ(scan2->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanPartiallyCompressed) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_seq_filtered.tbl", 2);
+
+  auto table_wrapper = get_table_op_part_dict();
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+  scan_1->execute();
+
+  EXPECT_TABLE_EQ(scan_1->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueGreaterThanMaxDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = all_rows;
+  tests[ScanType::OpLessThanEquals] = all_rows;
+  tests[ScanType::OpGreaterThan] = no_rows;
+  tests[ScanType::OpGreaterThanEquals] = no_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 30);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueLessThanMinDictionaryValue) {
+  const auto all_rows = std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  const auto no_rows = std::vector<AllTypeVariant>{};
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = no_rows;
+  tests[ScanType::OpNotEquals] = all_rows;
+  tests[ScanType::OpLessThan] = no_rows;
+  tests[ScanType::OpLessThanEquals] = no_rows;
+  tests[ScanType::OpGreaterThan] = all_rows;
+  tests[ScanType::OpGreaterThanEquals] = all_rows;
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0} /* "a" */, test.first, -10);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
+  // scanning for a value that is around the dictionary's bounds
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {100};
+  tests[ScanType::OpLessThan] = {};
+  tests[ScanType::OpLessThanEquals] = {100};
+  tests[ScanType::OpGreaterThan] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpNotEquals] = {102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 0);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
+  auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
+  scan_1->execute();
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(0));
+
+  // scan_1 produced an empty result
+  auto scan_2 = std::make_shared<opossum::TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 456.7);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(0));
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
+  // 2**8 + 1 values require a data type of 16bit.
+  const auto table_wrapper_dict_16 = get_table_op_with_n_dict_entries((1 << 8) + 1);
+  auto scan_1 = std::make_shared<opossum::TableScan>(table_wrapper_dict_16, ColumnID{0}, ScanType::OpGreaterThan, 200);
+  scan_1->execute();
+
+  EXPECT_EQ(scan_1->get_output()->row_count(), static_cast<size_t>(57));
+
+  // 2**16 + 1 values require a data type of 32bit.
+  const auto table_wrapper_dict_32 = get_table_op_with_n_dict_entries((1 << 16) + 1);
+  auto scan_2 =
+      std::make_shared<opossum::TableScan>(table_wrapper_dict_32, ColumnID{0}, ScanType::OpGreaterThan, 65500);
+  scan_2->execute();
+
+  EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnEncodedSegments) {
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  const auto create_table = [](const std::optional<EncodingType>& encoding_type) {
+    auto table = std::make_shared<Table>(100);
+    table->set_background_compression(std::nullopt);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto index = 0; index < 250; ++index) table->append({index / 7 % 20, std::string(1, 'a' + index % 5)});
+    if (encoding_type) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id, *encoding_type);
+      }
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto uncompressed = create_table(std::nullopt);
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength}) {
+    const auto encoded = create_table(encoding_type);
+    for (const auto scan_type : scan_types) {
+      for (const auto& [column_id, search_value] : std::vector<std::pair<ColumnID, AllTypeVariant>>{
+               {ColumnID{0}, 7}, {ColumnID{0}, -1}, {ColumnID{0}, 25}, {ColumnID{1}, std::string{"c"}},
+               {ColumnID{1}, std::string{"bb"}}, {ColumnID{1}, std::string{"z"}}}) {
+        auto expected = std::make_shared<TableScan>(uncompressed, column_id, scan_type, search_value);
+        expected->execute();
+        auto scan = std::make_shared<TableScan>(encoded, column_id, scan_type, search_value);
+        scan->execute();
+        EXPECT_TABLE_EQ(scan->get_output(), expected->get_output());
+
+        // scanning the output again uses the referenced segments
+        auto second_scan = std::make_shared<TableScan>(scan, ColumnID{0}, ScanType::OpLessThan, 10);
+        second_scan->execute();
+        auto expected_second_scan = std::make_shared<TableScan>(expected, ColumnID{0}, ScanType::OpLessThan, 10);
+        expected_second_scan->execute();
+        EXPECT_TABLE_EQ(second_scan->get_output(), expected_second_scan->get_output());
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, OutputReferencesDataSegments) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 120);
+  scan_2->execute();
+
+  const auto& chunk = scan_2->get_output()->get_chunk(ChunkID{0});
+  const auto segment_a = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{0}));
+  const auto segment_b = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment_a && segment_b);
+  EXPECT_EQ(segment_a->referenced_table(), _table_wrapper_even_dict->get_output());
+  EXPECT_EQ(segment_a->pos_list(), segment_b->pos_list());
+  EXPECT_EQ(scan_2->get_output()->row_count(), 8u);
+}
+
+TEST_F(OperatorsTableScanTest, SkipsPrunableChunks) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto index = 0; index < 30; ++index) table->append({index});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1});
+
+  // The zone map of the first chunk says that it cannot contain 15. If it is not scanned, the manipulated statistics
+  // of the second chunk also remove its match.
+  table->get_chunk(ChunkID{1}).set_segment_statistics(ColumnID{0},
+                                                      std::make_shared<SegmentStatistics<int>>(100, 200, 10));
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 15);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 0u);
+
+  scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 5);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 1u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanChunksLargerThanMorsels) {
+  // the first chunk consists of two morsels, the second one of a single, incomplete morsel
+  const auto row_count = static_cast<int>(3 * TableScan::MORSEL_SIZE - 100);
+  const auto create_table = [&](const std::optional<EncodingType>& encoding_type) {
+    auto table = std::make_shared<Table>(2 * TableScan::MORSEL_SIZE);
+    table->set_background_compression(std::nullopt);
+    table->add_column("a", "int");
+    for (auto index = 0; index < row_count; ++index) table->append({index % 1000});
+    if (encoding_type) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->compress_chunk(chunk_id, *encoding_type);
+      }
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto expected_values = [&](const int min, const int max) {
+    auto expected = std::make_shared<Table>();
+    expected->add_column("a", "int");
+    for (auto index = 0; index < row_count; ++index) {
+      if (index % 1000 >= min && index % 1000 <= max) expected->append({index % 1000});
+    }
+    return expected;
+  };
+
+  for (const auto& encoding_type : std::vector<std::optional<EncodingType>>{
+           std::nullopt, EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FrameOfReference}) {
+    const auto table_wrapper = create_table(encoding_type);
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+    scan->execute();
+    EXPECT_TABLE_EQ(scan->get_output(), expected_values(0, 9), true);
+
+    // the output of a non-selective scan is split into morsels again
+    scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 10);
+    scan->execute();
+    auto second_scan = std::make_shared<TableScan>(scan, ColumnID{0}, ScanType::OpLessThan, 20);
+    second_scan->execute();
+    EXPECT_TABLE_EQ(second_scan->get_output(), expected_values(10, 19), true);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, OutputReferencesEntireChunks) {
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan_1->execute();
+
+  // the first chunk matches partially, the second one entirely
+  const auto& output = *scan_1->get_output();
+  ASSERT_EQ(output.chunk_count(), 3u);
+  const auto pos_list_of = [&](const ChunkID chunk_id) {
+    return std::dynamic_pointer_cast<ReferenceSegment>(output.get_chunk(chunk_id).get_segment(ColumnID{0}))->pos_list();
+  };
+  EXPECT_FALSE(pos_list_of(ChunkID{0})->is_entire_chunk());
+  EXPECT_TRUE(pos_list_of(ChunkID{0})->references_single_chunk());
+  EXPECT_TRUE(pos_list_of(ChunkID{1})->is_entire_chunk());
+
+  // scanning the output again keeps the position lists of chunks that match entirely
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpLessThan, 200);
+  scan_2->execute();
+  const auto& second_output = *scan_2->get_output();
+  const auto second_segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(second_output.get_chunk(ChunkID{1}).get_segment(ColumnID{0}));
+  EXPECT_EQ(second_segment->pos_list(), pos_list_of(ChunkID{1}));
+  EXPECT_EQ(second_output.row_count(), 11u);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnInterleavedReferenceSegment) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 40; ++value) table->append({value});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+
+  // positions alternate between the chunks, so the scan groups them by chunk
+  auto pos_list = std::make_shared<PosList>();
+  for (auto index = ChunkOffset{0}; index < 40; ++index) pos_list->push_back(RowID{ChunkID{index % 4}, index / 4});
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", "int");
+  auto chunk = Chunk{};
+  chunk.add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list));
+  reference_table->emplace_chunk(std::move(chunk));
+  auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 23);
+  scan->execute();
+
+  // the matches keep the order of the input
+  const auto& output = *scan->get_output();
+  ASSERT_EQ(output.chunk_count(), 1u);
+  const auto segment = output.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  auto values = std::vector<AllTypeVariant>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment->size(); ++chunk_offset) {
+    values.push_back((*segment)[chunk_offset]);
+  }
+  auto expected = std::vector<AllTypeVariant>{};
+  for (auto index = 0; index < 40; ++index) {
+    if (index % 4 * 10 + index / 4 < 23) expected.emplace_back(index % 4 * 10 + index / 4);
+  }
+  EXPECT_EQ(values, expected);
+}
+
+TEST_F(OperatorsTableScanTest, ChainedScansIntersectSelections) {
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto index = 0; index < 2000; ++index) table->append({index % 2, index % 3});
+  table->compress_chunk(ChunkID{1});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // half of the rows match, so they are referenced by bitmaps
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 0);
+  scan_1->execute();
+  const auto& first_output = *scan_1->get_output();
+  ASSERT_EQ(first_output.chunk_count(), 2u);
+  const auto first_segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(first_output.get_chunk(ChunkID{0}).get_segment(ColumnID{1}));
+  ASSERT_TRUE(first_segment->pos_list()->selection());
+  EXPECT_TRUE(first_segment->pos_list()->selection()->is_bitmap());
+
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{1}, ScanType::OpEquals, 0);
+  scan_2->execute();
+  const auto& second_output = *scan_2->get_output();
+  EXPECT_EQ(second_output.row_count(), 334u);
+  const auto second_segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(second_output.get_chunk(ChunkID{1}).get_segment(ColumnID{0}));
+  EXPECT_EQ(second_segment->referenced_table(), table);
+  for (const auto& row_id : *second_segment->pos_list()) EXPECT_EQ((1000 + row_id.chunk_offset) % 6, 0u);
+
+  // a column with a different position list is filtered by the indices of the matches
+  auto mixed_table = std::make_shared<Table>();
+  mixed_table->add_column_definition("a", "int");
+  mixed_table->add_column_definition("b", "int");
+  auto row_ids = std::vector<RowID>{};
+  const auto& selection = *first_segment->pos_list()->selection();
+  selection.for_each([&](const ChunkOffset chunk_offset) { row_ids.push_back(RowID{ChunkID{0}, chunk_offset}); });
+  auto mixed_chunk = Chunk{};
+  mixed_chunk.add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{0}, std::make_shared<PosList>(row_ids)));
+  mixed_chunk.add_segment(first_segment);
+  mixed_table->emplace_chunk(std::move(mixed_chunk));
+  auto mixed_table_wrapper = std::make_shared<TableWrapper>(mixed_table);
+  mixed_table_wrapper->execute();
+
+  auto scan_3 = std::make_shared<TableScan>(mixed_table_wrapper, ColumnID{1}, ScanType::OpLessThan, 2);
+  scan_3->execute();
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "int");
+  for (auto index = 0; index < 1000; index += 2) {
+    if (index % 3 < 2) expected->append({0, index % 3});
+  }
+  EXPECT_TABLE_EQ(scan_3->get_output(), expected, true);
+}
 
 }  // namespace opossum
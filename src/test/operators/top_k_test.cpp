@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // There are more sealed chunks than workers, so TopK visits them in several waves and can skip the later ones. The
+    // ranges of column a descend from chunk to chunk and overlap, so the best rows are spread over multiple chunks and
+    // equal values occur in different chunks. The last chunk is not sealed, so it has no statistics.
+    // a: see value_of, b: the string of index % 4, c: index
+    _sealed_chunk_count = TaskScheduler::get().worker_count() + 3;
+    _row_count = _sealed_chunk_count * CHUNK_SIZE + 5;
+    _table = std::make_shared<Table>(CHUNK_SIZE);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "long");
+    for (auto index = size_t{0}; index < _row_count; ++index) {
+      _table->append({value_of(index), std::to_string(index % 4), static_cast<int64_t>(index)});
+    }
+    _table->wait_for_background_compression();
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // the values of a chunk lie in [10 * n, 10 * n + 11], where n is the number of chunks after it
+  int32_t value_of(const size_t index) const {
+    return static_cast<int32_t>((_sealed_chunk_count - index / CHUNK_SIZE) * 10 + index * 7 % 12);
+  }
+
+  // checks that TopK returns the first k rows of the Sort output
+  static void expect_prefix_of_sort(const std::shared_ptr<const AbstractOperator>& in,
+                                    const std::vector<SortColumnDefinition>& sort_definitions, const size_t k) {
+    auto top_k = std::make_shared<TopK>(in, sort_definitions, k);
+    top_k->execute();
+    auto sort = std::make_shared<Sort>(in, sort_definitions);
+    sort->execute();
+
+    const auto& output = *top_k->get_output();
+    const auto& sorted = *sort->get_output();
+    EXPECT_EQ(output.row_count(), std::min(k, size_t{sorted.row_count()}));
+    for (auto column_id = ColumnID{0}; column_id < output.column_count(); ++column_id) {
+      auto expected = column_values(sorted, column_id);
+      expected.resize(output.row_count());
+      EXPECT_EQ(column_values(output, column_id), expected);
+    }
+  }
+
+  static constexpr auto CHUNK_SIZE = size_t{10};
+
+  size_t _sealed_chunk_count;
+  size_t _row_count;
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, Ascending) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}}, 5);
+  top_k->execute();
+
+  const auto& output = *top_k->get_output();
+  EXPECT_EQ(output.chunk_count(), 1u);
+  EXPECT_NE(std::dynamic_pointer_cast<ReferenceSegment>(output.get_chunk(ChunkID{0}).get_segment(ColumnID{0})),
+            nullptr);
+  expect_prefix_of_sort(_table_wrapper, {{ColumnID{0}}}, 5);
+}
+
+TEST_F(OperatorsTopKTest, KSpansChunks) {
+  // k is below, equal to, and above the chunk size, so the best rows come from one or more chunks
+  for (const auto k : {size_t{1}, CHUNK_SIZE - 1, CHUNK_SIZE, CHUNK_SIZE + 1, 3 * CHUNK_SIZE + 2}) {
+    expect_prefix_of_sort(_table_wrapper, {{ColumnID{0}}}, k);
+    expect_prefix_of_sort(_table_wrapper, {{ColumnID{0}, OrderByMode::Descending}}, k);
+    expect_prefix_of_sort(_table_wrapper, {{ColumnID{1}, OrderByMode::Descending}, {ColumnID{0}}}, k);
+    expect_prefix_of_sort(_table_wrapper, {{ColumnID{0}}, {ColumnID{2}, OrderByMode::Descending}}, k);
+  }
+}
+
+TEST_F(OperatorsTopKTest, KExceedsRowCount) {
+  expect_prefix_of_sort(_table_wrapper, {{ColumnID{0}, OrderByMode::Descending}}, _row_count + 1);
+}
+
+TEST_F(OperatorsTopKTest, KIsZero) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}}, 0);
+  top_k->execute();
+
+  const auto& output = *top_k->get_output();
+  EXPECT_EQ(output.row_count(), 0u);
+  EXPECT_EQ(output.get_chunk(ChunkID{0}).column_count(), 3u);
+}
+
+TEST_F(OperatorsTopKTest, ReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpGreaterThanEquals, int64_t{12});
+  scan->execute();
+  expect_prefix_of_sort(scan, {{ColumnID{0}, OrderByMode::Descending}, {ColumnID{1}}}, CHUNK_SIZE + 3);
+
+  auto top_k = std::make_shared<TopK>(scan, std::vector<SortColumnDefinition>{{ColumnID{2}}}, 3);
+  top_k->execute();
+  EXPECT_EQ(column_values(*top_k->get_output(), ColumnID{2}),
+            (std::vector<AllTypeVariant>{int64_t{12}, int64_t{13}, int64_t{14}}));
+
+  // the output references the data table
+  const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(
+      top_k->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{1}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsTopKTest, SkipsChunksByStatistics) {
+  // Chunks whose statistics rule them out are not read. The statistics of the last sealed chunk, which holds the
+  // smallest values besides the unsealed chunk, claim that it cannot hold any of the best rows. Thus, it is visited
+  // last and skipped, and its rows are missing from the output.
+  const auto skipped_chunk_id = ChunkID{static_cast<ChunkID::base_type>(_sealed_chunk_count - 1)};
+  _table->get_chunk(skipped_chunk_id)
+      .set_segment_statistics(ColumnID{0}, std::make_shared<SegmentStatistics<int32_t>>(1000, 2000, 10));
+
+  const auto k = CHUNK_SIZE + 5;
+  auto top_k = std::make_shared<TopK>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}}, k);
+  top_k->execute();
+
+  auto expected_rows = std::vector<std::pair<int32_t, int64_t>>{};
+  for (auto index = size_t{0}; index < _row_count; ++index) {
+    if (index / CHUNK_SIZE != _sealed_chunk_count - 1) expected_rows.emplace_back(value_of(index), index);
+  }
+  std::stable_sort(expected_rows.begin(), expected_rows.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  expected_rows.resize(k);
+
+  auto expected_a = std::vector<AllTypeVariant>{};
+  auto expected_c = std::vector<AllTypeVariant>{};
+  for (const auto& [value, index] : expected_rows) {
+    expected_a.emplace_back(value);
+    expected_c.emplace_back(index);
+  }
+  EXPECT_EQ(column_values(*top_k->get_output(), ColumnID{0}), expected_a);
+  EXPECT_EQ(column_values(*top_k->get_output(), ColumnID{2}), expected_c);
+}
+
+}  // namespace opossum
@@ -0,0 +1,108 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/task_group.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a: index % 50, b: the string of index % 3
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto index = 0; index < 1'000; ++index) _table->append({index % 50, std::to_string(index % 3)});
+    _table->compress_chunk(ChunkID{1});
+  }
+
+  // Returns a plan that joins two scans of the same table and aggregates the result. Both scans are independent of
+  // each other, but share their input.
+  std::shared_ptr<AbstractOperator> make_plan() const {
+    const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+    const auto left_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 10);
+    const auto right_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, "1");
+    const auto join = std::make_shared<JoinHash>(left_scan, right_scan, std::make_pair(ColumnID{0}, ColumnID{0}));
+    return std::make_shared<Aggregate>(join,
+                                       std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}},
+                                       std::vector<ColumnID>{ColumnID{1}});
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorTaskTest, ExecutesPlan) {
+  const auto plan = make_plan();
+  const auto tasks = OperatorTask::make_tasks_from_operator(plan);
+
+  // the shared TableWrapper gets a single task, and each task comes after its predecessors
+  ASSERT_EQ(tasks.size(), 5u);
+  EXPECT_EQ(std::static_pointer_cast<OperatorTask>(tasks.back())->get_operator(), plan);
+  EXPECT_TRUE(tasks.front()->is_ready());
+  EXPECT_FALSE(tasks.back()->is_ready());
+  TaskScheduler::get().schedule_and_wait_for_tasks(tasks);
+
+  // execute the same plan operator by operator
+  const auto expected_plan = make_plan();
+  const auto aggregate_input = std::const_pointer_cast<AbstractOperator>(expected_plan->input_left());
+  const auto left_scan = std::const_pointer_cast<AbstractOperator>(aggregate_input->input_left());
+  const auto right_scan = std::const_pointer_cast<AbstractOperator>(aggregate_input->input_right());
+  std::const_pointer_cast<AbstractOperator>(left_scan->input_left())->execute();
+  left_scan->execute();
+  right_scan->execute();
+  aggregate_input->execute();
+  expected_plan->execute();
+
+  EXPECT_TABLE_EQ(plan->get_output(), expected_plan->get_output());
+  EXPECT_EQ(plan->get_output()->row_count(), 3u);
+}
+
+TEST_F(OperatorTaskTest, SkipsExecutedOperators) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 7);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(scan);
+  ASSERT_EQ(tasks.size(), 1u);
+  TaskScheduler::get().schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(scan->get_output()->row_count(), 20u);
+}
+
+TEST_F(OperatorTaskTest, LimitsConcurrencyOfQuery) {
+  const auto plan = make_plan();
+  const auto group = std::make_shared<TaskGroup>(1);
+  const auto tasks = OperatorTask::make_tasks_from_operator(plan, group);
+  for (const auto& task : tasks) EXPECT_EQ(task->group(), group);
+  TaskScheduler::get().schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(plan->get_output()->row_count(), 3u);
+  EXPECT_EQ(group->active_task_count(), 0u);
+}
+
+TEST_F(OperatorTaskTest, PropagatesExceptions) {
+  // the aggregate fails, and the scan must not be executed on its missing output
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  const auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{0}});
+  const auto scan = std::make_shared<TableScan>(aggregate, ColumnID{0}, ScanType::OpEquals, 7);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(scan);
+  EXPECT_THROW(TaskScheduler::get().schedule_and_wait_for_tasks(tasks), std::logic_error);
+  EXPECT_EQ(scan->get_output(), nullptr);
+}
+
+}  // namespace opossum
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_group.hpp"
+#include "scheduler/task_scheduler.hpp"
+
+namespace opossum {
+
+class TaskSchedulerTest : public BaseTest {};
+
+TEST_F(TaskSchedulerTest, ExecutesJobs) {
+  auto counter = std::atomic<uint32_t>{0};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = 0; job_id < 100; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  EXPECT_EQ(counter, 100u);
+  for (const auto& job : jobs) EXPECT_TRUE(job->is_done());
+}
+
+TEST_F(TaskSchedulerTest, RespectsDependencies) {
+  auto order = std::vector<uint32_t>{};
+
+  const auto first = std::make_shared<JobTask>([&]() { order.push_back(1); });
+  const auto second = std::make_shared<JobTask>([&]() { order.push_back(2); });
+  const auto third = std::make_shared<JobTask>([&]() { order.push_back(3); });
+  first->set_as_predecessor_of(second);
+  second->set_as_predecessor_of(third);
+
+  EXPECT_TRUE(first->is_ready());
+  EXPECT_FALSE(third->is_ready());
+
+  // Scheduling in reverse order must not change the execution order
+  TaskScheduler::get().schedule_and_wait_for_tasks({third, second, first});
+
+  EXPECT_EQ(order, (std::vector<uint32_t>{1, 2, 3}));
+}
+
+TEST_F(TaskSchedulerTest, NestedJobs) {
+  // More outer jobs than workers, all of which wait for inner jobs. Waiting threads execute pending tasks themselves,
+  // so this must not deadlock.
+  const auto outer_job_count = TaskScheduler::get().worker_count() * 4;
+  auto counter = std::atomic<uint32_t>{0};
+
+  auto outer_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto outer_job_id = size_t{0}; outer_job_id < outer_job_count; ++outer_job_id) {
+    outer_jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      auto inner_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto inner_job_id = 0; inner_job_id < 10; ++inner_job_id) {
+        inner_jobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+      }
+      TaskScheduler::get().schedule_and_wait_for_tasks(inner_jobs);
+    }));
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(outer_jobs);
+
+  EXPECT_EQ(counter, outer_job_count * 10);
+}
+
+TEST_F(TaskSchedulerTest, PropagatesExceptions) {
+  const auto failing_job = std::make_shared<JobTask>([]() { throw std::logic_error("failed"); });
+  failing_job->schedule();
+  EXPECT_THROW(failing_job->join(), std::logic_error);
+  EXPECT_TRUE(failing_job->is_done());
+}
+
+TEST_F(TaskSchedulerTest, LimitsConcurrencyOfGroup) {
+  // Without the limit, the waiting thread executes jobs alongside the workers
+  const auto group = std::make_shared<TaskGroup>(1);
+  auto running_job_count = std::atomic<uint32_t>{0};
+  auto max_running_job_count = std::atomic<uint32_t>{0};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = 0; job_id < 20; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      const auto count = ++running_job_count;
+      auto max_count = max_running_job_count.load();
+      while (max_count < count && !max_running_job_count.compare_exchange_weak(max_count, count)) continue;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      --running_job_count;
+    }));
+    jobs.back()->set_group(group);
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(jobs);
+
+  EXPECT_EQ(max_running_job_count, 1u);
+  EXPECT_EQ(group->active_task_count(), 0u);
+}
+
+TEST_F(TaskSchedulerTest, NestedJobsJoinGroup) {
+  // The outer jobs leave room for the inner jobs while they wait, so this must not deadlock
+  const auto group = std::make_shared<TaskGroup>(1);
+  auto counter = std::atomic<uint32_t>{0};
+
+  auto outer_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto outer_job_id = 0; outer_job_id < 4; ++outer_job_id) {
+    outer_jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      auto inner_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto inner_job_id = 0; inner_job_id < 10; ++inner_job_id) {
+        inner_jobs.emplace_back(std::make_shared<JobTask>([&]() {
+          if (TaskGroup::current() == group) ++counter;
+        }));
+      }
+      TaskScheduler::get().schedule_and_wait_for_tasks(inner_jobs);
+      for (const auto& inner_job : inner_jobs) EXPECT_EQ(inner_job->group(), group);
+    }));
+    outer_jobs.back()->set_group(group);
+  }
+  TaskScheduler::get().schedule_and_wait_for_tasks(outer_jobs);
+
+  EXPECT_EQ(counter, 40u);
+  EXPECT_EQ(group->active_task_count(), 0u);
+  EXPECT_EQ(TaskGroup::current(), nullptr);
+}
+
+TEST_F(TaskSchedulerTest, WaitingThreadsOnlyHelpTheirGroups) {
+  // A thread that waits for the tasks of one query does not execute the tasks of another query
+  const auto waiting_thread_id = std::this_thread::get_id();
+  auto other_job_ran_while_waiting = std::atomic_bool{false};
+
+  const auto job = std::make_shared<JobTask>([]() { std::this_thread::sleep_for(std::chrono::milliseconds(5)); });
+  job->set_group(std::make_shared<TaskGroup>(1));
+
+  const auto other_group = std::make_shared<TaskGroup>(1);
+  auto other_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = 0; job_id < 20; ++job_id) {
+    other_jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      if (std::this_thread::get_id() == waiting_thread_id && !job->is_done()) other_job_ran_while_waiting = true;
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }));
+    other_jobs.back()->set_group(other_group);
+    other_jobs.back()->schedule();
+  }
+  job->schedule();
+  job->join();
+  TaskScheduler::get().wait_for_tasks(other_jobs);
+
+  EXPECT_FALSE(other_job_ran_while_waiting);
+  EXPECT_EQ(other_group->active_task_count(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/histogram.hpp"
+
+namespace opossum {
+
+class StatisticsHistogramTest : public BaseTest {
+ protected:
+  // 1, 2, ..., 10 once each and 100 ten times
+  const std::vector<std::pair<int, size_t>> value_counts{{1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1}, {6, 1},
+                                                         {7, 1}, {8, 1}, {9, 1}, {10, 1}, {100, 10}};
+};
+
+TEST_F(StatisticsHistogramTest, EquiHeightBins) {
+  const auto histogram = Histogram<int>::build(value_counts, 4);
+  EXPECT_EQ(histogram->total_count(), 20u);
+  EXPECT_EQ(histogram->distinct_count(), 11u);
+
+  // bins of at least five rows, the frequent value gets its own bin
+  ASSERT_EQ(histogram->bin_count(), 3u);
+  EXPECT_EQ(histogram->bins()[0].min, 1);
+  EXPECT_EQ(histogram->bins()[0].max, 5);
+  EXPECT_EQ(histogram->bins()[1].min, 6);
+  EXPECT_EQ(histogram->bins()[1].max, 10);
+  EXPECT_EQ(histogram->bins()[2].min, 100);
+  EXPECT_EQ(histogram->bins()[2].height, 10u);
+}
+
+TEST_F(StatisticsHistogramTest, EquiWidthBins) {
+  const auto histogram = Histogram<int>::build(value_counts, 4, HistogramType::EquiWidth);
+
+  // the range 1..100 is split into four bins of which only the first and last hold values
+  ASSERT_EQ(histogram->bin_count(), 2u);
+  EXPECT_EQ(histogram->bins()[0].max, 10);
+  EXPECT_EQ(histogram->bins()[1].min, 100);
+
+  // strings fall back to equi-height
+  const auto string_histogram =
+      Histogram<std::string>::build({{"a", 1}, {"b", 1}, {"c", 1}}, 3, HistogramType::EquiWidth);
+  EXPECT_EQ(string_histogram->bin_count(), 3u);
+}
+
+TEST_F(StatisticsHistogramTest, EstimateCardinality) {
+  const auto histogram = Histogram<int>::build(value_counts, 4);
+
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpEquals, 100), 10.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpEquals, 3), 1.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpEquals, 50), 0.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpNotEquals, 100), 10.0f);
+
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpLessThan, 3), 2.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpLessThanEquals, 3), 3.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpGreaterThan, 10), 10.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpGreaterThanEquals, 1), 20.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpLessThan, 0), 0.0f);
+
+  // the search value is cast to the histogram's type
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpEquals, AllTypeVariant{"100"}), 10.0f);
+}
+
+TEST_F(StatisticsHistogramTest, EstimatesStayWithinBin) {
+  // five 0s and five 9s, so the estimates for "< 9" and "= 9" must not add up to more than the bin
+  auto bins = std::vector<Histogram<int>::Bin>{{0, 9, 10, 2}, {20, 29, 10, 10}};
+  const auto histogram = std::make_shared<Histogram<int>>(std::move(bins));
+
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpLessThan, 9), 5.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpLessThanEquals, 9), 10.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpGreaterThan, 9), 10.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpGreaterThanEquals, 9), 15.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpLessThanEquals, 29), 20.0f);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpGreaterThan, 29), 0.0f);
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto value : {-1, 0, 5, 9, 15, 20, 29, 30}) {
+      const auto cardinality = histogram->estimate_cardinality(scan_type, value);
+      EXPECT_GE(cardinality, 0.0f);
+      EXPECT_LE(cardinality, 20.0f);
+    }
+  }
+}
+
+TEST_F(StatisticsHistogramTest, EmptyHistogram) {
+  const auto histogram = Histogram<float>::build({}, 10);
+  EXPECT_EQ(histogram->bin_count(), 0u);
+  EXPECT_FLOAT_EQ(histogram->estimate_cardinality(ScanType::OpLessThan, 1.0f), 0.0f);
+}
+
+}  // namespace opossum
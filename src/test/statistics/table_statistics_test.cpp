@@ -0,0 +1,56 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StatisticsTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    for (auto row = 0; row < 100; ++row) {
+      table->append({row % 50, row < 90 ? std::string{"frequent"} : std::string{"rare"}});
+    }
+
+    // mix encodings across chunks
+    table->wait_for_background_compression();
+    table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(StatisticsTableStatisticsTest, EstimateSelectivity) {
+  const auto statistics = TableStatistics(*table, 10);
+  EXPECT_EQ(statistics.row_count(), 100u);
+
+  const auto histogram = statistics.column_histogram(ColumnID{0});
+  EXPECT_EQ(histogram->total_count(), 100u);
+  EXPECT_EQ(histogram->distinct_count(), 50u);
+
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 7), 0.02f);
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 25), 0.5f);
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThan, 60), 0.0f);
+
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpEquals, std::string{"frequent"}), 0.9f);
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpNotEquals, std::string{"frequent"}), 0.1f);
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpEquals, std::string{"unknown"}), 0.0f);
+}
+
+TEST_F(StatisticsTableStatisticsTest, StoredOnTable) {
+  EXPECT_EQ(table->table_statistics(), nullptr);
+  table->set_table_statistics(std::make_shared<TableStatistics>(*table));
+  ASSERT_NE(table->table_statistics(), nullptr);
+  EXPECT_EQ(table->table_statistics()->row_count(), 100u);
+}
+
+}  // namespace opossum
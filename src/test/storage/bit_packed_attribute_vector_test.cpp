@@ -0,0 +1,79 @@
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/bit_packed_attribute_vector.hpp"
+
+TEST(BitPackedAttributeVectorTest, GetAndSet) {
+  opossum::BitPackedAttributeVector vec(3, 4);
+  vec.set(0, opossum::ValueID{3});
+  vec.set(1, opossum::ValueID{15});
+  vec.set(2, opossum::ValueID{1});
+
+  EXPECT_EQ(vec.get(0), 3);
+  EXPECT_EQ(vec.get(1), 15);
+  EXPECT_EQ(vec.get(2), 1);
+
+  // Overwriting a value must not affect its neighbors
+  vec.set(1, opossum::ValueID{0});
+  EXPECT_EQ(vec.get(0), 3);
+  EXPECT_EQ(vec.get(1), 0);
+  EXPECT_EQ(vec.get(2), 1);
+
+  if (IS_DEBUG) {
+    EXPECT_THROW(vec.set(5, opossum::ValueID{0}), std::exception);
+    EXPECT_THROW(vec.set(0, opossum::ValueID{16}), std::exception);
+    EXPECT_THROW(vec.get(6), std::exception);
+  }
+}
+
+TEST(BitPackedAttributeVectorTest, ValuesSpanningWords) {
+  // With 9 bits, every seventh value crosses a 64-bit word boundary
+  for (const auto bit_width : {uint8_t{1}, uint8_t{7}, uint8_t{9}, uint8_t{17}, uint8_t{31}, uint8_t{32}}) {
+    const auto max_value = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    opossum::BitPackedAttributeVector vec(200, bit_width);
+    for (auto index = size_t{0}; index < vec.size(); ++index) {
+      vec.set(index, opossum::ValueID{static_cast<uint32_t>((index * 2654435761u) & max_value)});
+    }
+    for (auto index = size_t{0}; index < vec.size(); ++index) {
+      EXPECT_EQ(vec.get(index), static_cast<uint32_t>((index * 2654435761u) & max_value));
+    }
+  }
+}
+
+TEST(BitPackedAttributeVectorTest, Decode) {
+  opossum::BitPackedAttributeVector vec(100, 9);
+  for (auto index = size_t{0}; index < vec.size(); ++index) {
+    vec.set(index, opossum::ValueID{static_cast<uint32_t>(index * 5)});
+  }
+
+  std::vector<opossum::ValueID> decoded;
+  vec.decode(13, 77, decoded);
+  ASSERT_EQ(decoded.size(), 64u);
+  for (auto index = size_t{0}; index < decoded.size(); ++index) {
+    EXPECT_EQ(decoded[index], (index + 13) * 5);
+  }
+}
+
+TEST(BitPackedAttributeVectorTest, WidthAndMemoryUsage) {
+  opossum::BitPackedAttributeVector vec1(64, 1);
+  opossum::BitPackedAttributeVector vec9(64, 9);
+  opossum::BitPackedAttributeVector vec32(3, 32);
+
+  EXPECT_EQ(vec1.width(), 1);
+  EXPECT_EQ(vec9.width(), 2);
+  EXPECT_EQ(vec32.width(), 4);
+
+  EXPECT_EQ(vec1.estimate_memory_usage(), 8u);
+  EXPECT_EQ(vec9.estimate_memory_usage(), 72u);
+  EXPECT_EQ(vec32.estimate_memory_usage(), 16u);
+}
+
+TEST(BitPackedAttributeVectorTest, RequiredBitWidth) {
+  EXPECT_EQ(opossum::BitPackedAttributeVector::required_bit_width(0), 1);
+  EXPECT_EQ(opossum::BitPackedAttributeVector::required_bit_width(1), 1);
+  EXPECT_EQ(opossum::BitPackedAttributeVector::required_bit_width(2), 2);
+  EXPECT_EQ(opossum::BitPackedAttributeVector::required_bit_width(300), 9);
+  EXPECT_EQ(opossum::BitPackedAttributeVector::required_bit_width(std::numeric_limits<uint32_t>::max()), 32);
+}
@@ -0,0 +1,89 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/bloom_filter.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BloomFilter{1000, 0.01};
+  for (auto value = 0; value < 1000; ++value) bloom_filter.insert(value * 7);
+
+  for (auto value = 0; value < 1000; ++value) EXPECT_TRUE(bloom_filter.may_contain(value * 7));
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  auto bloom_filter = BloomFilter{10'000, 0.01};
+  for (auto value = int64_t{0}; value < 10'000; ++value) bloom_filter.insert(value);
+
+  auto false_positives = 0;
+  for (auto value = int64_t{10'000}; value < 110'000; ++value) {
+    if (bloom_filter.may_contain(value)) ++false_positives;
+  }
+  EXPECT_LT(false_positives, 2'000);
+
+  // ~9.6 bits and 7 hash functions per value are optimal for 1%
+  EXPECT_EQ(bloom_filter.hash_count(), 7u);
+  EXPECT_EQ(bloom_filter.estimate_memory_usage(), bloom_filter.bit_count() / 8);
+  EXPECT_NEAR(static_cast<double>(bloom_filter.bit_count()) / 10'000, 9.6, 0.1);
+}
+
+TEST_F(StorageBloomFilterTest, MemoryIsBounded) {
+  const auto bloom_filter = BloomFilter{1'000'000, 0.0001, 1024};
+  EXPECT_EQ(bloom_filter.estimate_memory_usage(), 1024u);
+  EXPECT_GE(bloom_filter.hash_count(), 1u);
+
+  EXPECT_THROW(BloomFilter(10, 1.5), std::logic_error);
+}
+
+TEST_F(StorageBloomFilterTest, FloatingPointZero) {
+  auto bloom_filter = BloomFilter{10, 0.01};
+  bloom_filter.insert(-0.0);
+  EXPECT_TRUE(bloom_filter.may_contain(0.0));
+}
+
+TEST_F(StorageBloomFilterTest, BuildFromSegment) {
+  const auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (const auto& value : {"Steve", "Bill", "Hasso", "Bill"}) value_segment->append(value);
+  const auto dictionary_segment = DictionarySegment<std::string>(value_segment);
+
+  for (const BaseSegment* segment : {static_cast<const BaseSegment*>(value_segment.get()),
+                                     static_cast<const BaseSegment*>(&dictionary_segment)}) {
+    const auto bloom_filter = BloomFilter::build("string", *segment, 3, 0.01);
+    EXPECT_TRUE(bloom_filter->may_contain(std::string{"Steve"}));
+    EXPECT_TRUE(bloom_filter->may_contain(std::string{"Bill"}));
+    EXPECT_TRUE(bloom_filter->may_contain(std::string{"Hasso"}));
+  }
+}
+
+TEST_F(StorageBloomFilterTest, BuiltOnCompression) {
+  auto table = Table{100};
+  table.add_column("a", "int");
+  table.set_background_compression(std::nullopt);
+  for (auto value = 0; value < 100; ++value) table.append({value * 3});
+
+  table.compress_chunk(ChunkID{0});
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).get_segment_bloom_filter(ColumnID{0}), nullptr);
+  const auto memory_usage_without_filter = table.get_chunk(ChunkID{0}).estimate_memory_usage();
+
+  table.set_bloom_filters(0.01);
+  table.compress_chunk(ChunkID{0});
+  const auto& chunk = table.get_chunk(ChunkID{0});
+  const auto bloom_filter = chunk.get_segment_bloom_filter(ColumnID{0});
+  ASSERT_NE(bloom_filter, nullptr);
+  EXPECT_TRUE(bloom_filter->may_contain(297));
+  EXPECT_EQ(chunk.estimate_memory_usage(), memory_usage_without_filter + bloom_filter->estimate_memory_usage());
+
+  EXPECT_THROW(table.set_bloom_filters(0.0), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_selection.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class StorageChunkSelectionTest : public BaseTest {
+ protected:
+  static std::vector<ChunkOffset> for_each_offsets(const ChunkSelection& selection) {
+    auto offsets = std::vector<ChunkOffset>{};
+    selection.for_each([&](const ChunkOffset chunk_offset) { offsets.push_back(chunk_offset); });
+    return offsets;
+  }
+
+  // every third offset of a chunk of 1000 rows, which is stored as a bitmap
+  const std::vector<ChunkOffset> dense_offsets = [] {
+    auto offsets = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1000; chunk_offset += 3) offsets.push_back(chunk_offset);
+    return offsets;
+  }();
+};
+
+TEST_F(StorageChunkSelectionTest, ChoosesRepresentation) {
+  const auto sparse = ChunkSelection{1000, {3, 500, 999}};
+  EXPECT_FALSE(sparse.is_bitmap());
+  EXPECT_EQ(sparse.size(), 3u);
+  EXPECT_EQ(sparse.estimate_memory_usage(), 12u);
+
+  const auto dense = ChunkSelection{1000, dense_offsets};
+  EXPECT_TRUE(dense.is_bitmap());
+  EXPECT_EQ(dense.size(), dense_offsets.size());
+  EXPECT_LT(dense.estimate_memory_usage(), dense_offsets.size() * sizeof(ChunkOffset));
+
+  // bitmaps that turn out to be sparse become selection vectors
+  auto words = std::vector<uint64_t>(16);
+  words[2] = 0b101;
+  const auto from_bitmap = ChunkSelection::from_bitmap(1000, words);
+  EXPECT_FALSE(from_bitmap.is_bitmap());
+  EXPECT_EQ(from_bitmap.selection_vector(), (std::vector<ChunkOffset>{128, 130}));
+}
+
+TEST_F(StorageChunkSelectionTest, AccessBitmap) {
+  const auto selection = ChunkSelection{1000, dense_offsets};
+  ASSERT_TRUE(selection.is_bitmap());
+
+  EXPECT_EQ(for_each_offsets(selection), dense_offsets);
+  EXPECT_EQ(selection.offsets(), dense_offsets);
+  for (auto index = size_t{0}; index < dense_offsets.size(); ++index) {
+    EXPECT_EQ(selection[index], dense_offsets[index]);
+    EXPECT_EQ(selection.rank(dense_offsets[index]), index);
+  }
+  EXPECT_TRUE(selection.contains(999));
+  EXPECT_FALSE(selection.contains(998));
+  EXPECT_EQ(selection.rank(1000), dense_offsets.size());
+}
+
+TEST_F(StorageChunkSelectionTest, Intersect) {
+  auto even_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1000; chunk_offset += 2) even_offsets.push_back(chunk_offset);
+  auto expected = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1000; chunk_offset += 6) expected.push_back(chunk_offset);
+
+  const auto every_third = ChunkSelection{1000, dense_offsets};
+  const auto even = ChunkSelection{1000, even_offsets};
+  const auto bitmap_intersection = every_third.intersect(even);
+  EXPECT_TRUE(bitmap_intersection.is_bitmap());
+  EXPECT_EQ(bitmap_intersection.offsets(), expected);
+
+  const auto sparse = ChunkSelection{1000, {2, 3, 6, 998}};
+  EXPECT_EQ(every_third.intersect(sparse).offsets(), (std::vector<ChunkOffset>{3, 6}));
+  EXPECT_EQ(sparse.intersect(even).offsets(), (std::vector<ChunkOffset>{2, 6, 998}));
+  EXPECT_EQ(sparse.intersect(ChunkSelection{1000, {0, 6, 998}}).offsets(), (std::vector<ChunkOffset>{6, 998}));
+}
+
+}  // namespace opossum
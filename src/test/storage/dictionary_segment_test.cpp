@@ -1,6 +1,8 @@
 #include <limits>
 #include <memory>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -52,6 +54,32 @@ TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
   EXPECT_EQ((*dict)[3], "Steve");
 }
 
+TEST_F(StorageDictionarySegmentTest, CompressUnsortedValues) {
+  auto vs = std::make_shared<ValueSegment<int64_t>>();
+  auto expected_dictionary = std::set<int64_t>{};
+  for (auto index = int64_t{0}; index < 1000; ++index) {
+    const auto value = (index * 7919) % 263 - 131;
+    vs->append(value);
+    expected_dictionary.insert(value);
+  }
+
+  DictionarySegment<int64_t> ds(vs);
+  EXPECT_EQ(*ds.dictionary(), std::vector<int64_t>(expected_dictionary.cbegin(), expected_dictionary.cend()));
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < vs->size(); ++chunk_offset) {
+    EXPECT_EQ(ds.get(chunk_offset), vs->values()[chunk_offset]);
+  }
+}
+
+TEST_F(StorageDictionarySegmentTest, LowerUpperBoundString) {
+  DictionarySegment<std::string> dict_col(vs_str);
+
+  EXPECT_EQ(dict_col.lower_bound(std::string{"Bill"}), ValueID{1});
+  EXPECT_EQ(dict_col.upper_bound(std::string{"Bill"}), ValueID{2});
+  EXPECT_EQ(dict_col.lower_bound(std::string{"Carl"}), ValueID{2});
+  EXPECT_EQ(dict_col.upper_bound(std::string{"Steve"}), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col.value_by_value_id(ValueID{2}), "Hasso");
+}
+
 TEST_F(StorageDictionarySegmentTest, LowerUpperBoundAllTypeVariant) {
   vs_int->append(4);
   vs_int->append(5);
@@ -101,7 +129,24 @@ TEST_F(StorageDictionarySegmentTest, AttributeVectorIsWideEnough) {
     vs->append(i);
   }
   DictionarySegment<int> ds32(vs);
-  EXPECT_EQ(ds32.attribute_vector()->width(), 4);
+  EXPECT_EQ(ds32.attribute_vector()->width(), 3);
+}
+
+TEST_F(StorageDictionarySegmentTest, AttributeVectorIsBitPacked) {
+  std::shared_ptr<ValueSegment<int>> vs = std::make_shared<ValueSegment<int>>();
+  for (int i = 0; i < 300; i++) {
+    vs->append(i);
+  }
+  DictionarySegment<int> ds(vs);
+
+  // 300 unique values need 9 bits per value id instead of the 16 bits of a FixedSizeAttributeVector<uint16_t>
+  auto bit_packed = std::dynamic_pointer_cast<const BitPackedAttributeVector>(ds.attribute_vector());
+  ASSERT_NE(bit_packed, nullptr);
+  EXPECT_EQ(bit_packed->bit_width(), 9);
+
+  for (int i = 0; i < 300; i++) {
+    EXPECT_EQ(ds.get(i), i);
+  }
 }
 
 TEST_F(StorageDictionarySegmentTest, AccessWithSubscriptOperator) {
@@ -173,7 +218,8 @@ TEST_F(StorageDictionarySegmentTest, EstimateMemoryUsage) {
   for (int i = vs->size(); i < std::numeric_limits<uint8_t>::max() + 1; i++) {
     vs->append(i);
   }
+  // 256 unique values are bit-packed with 9 bits each: 256 * 4 bytes dictionary + 36 * 8 bytes attribute vector
   DictionarySegment<int> ds16(vs);
-  EXPECT_EQ(ds16.estimate_memory_usage(), 1536);
+  EXPECT_EQ(ds16.estimate_memory_usage(), 1312);
 }
 }  // namespace opossum
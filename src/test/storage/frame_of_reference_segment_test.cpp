@@ -0,0 +1,137 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Two blocks: increasing timestamps in the first block, a narrow range of negative values in the second
+    for (auto index = int64_t{0}; index < static_cast<int64_t>(FrameOfReferenceSegment<int64_t>::BLOCK_SIZE); ++index) {
+      vs_long->append(int64_t{1'500'000'000'000} + index * 3);
+    }
+    for (auto index = int64_t{0}; index < 100; ++index) {
+      vs_long->append(-1000 - index % 7);
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int64_t>> vs_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegment) {
+  FrameOfReferenceSegment<int64_t> for_segment(vs_long);
+
+  EXPECT_EQ(for_segment.size(), vs_long->size());
+  EXPECT_EQ(for_segment.block_minima(), (std::vector<int64_t>{1'500'000'000'000, -1006}));
+  // The largest offset of the first block is 2047 * 3 = 6141, which needs 13 bits, the second block needs 3 bits
+  EXPECT_EQ(for_segment.block_bit_widths(), (std::vector<uint8_t>{13, 3}));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, AccessValues) {
+  FrameOfReferenceSegment<int64_t> for_segment(vs_long);
+
+  const auto& values = vs_long->values();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    EXPECT_EQ(for_segment.get(chunk_offset), values[chunk_offset]);
+  }
+  EXPECT_EQ(for_segment[2], static_cast<AllTypeVariant>(int64_t{1'500'000'000'006}));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, DecodeBlock) {
+  FrameOfReferenceSegment<int64_t> for_segment(vs_long);
+
+  std::vector<int64_t> decoded;
+  for_segment.decode_block(1, decoded);
+  ASSERT_EQ(decoded.size(), 100u);
+  EXPECT_EQ(decoded, std::vector<int64_t>(vs_long->values().cbegin() + FrameOfReferenceSegment<int64_t>::BLOCK_SIZE,
+                                          vs_long->values().cend()));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, ExtremeValues) {
+  auto vs_int = std::make_shared<ValueSegment<int32_t>>();
+  vs_int->append(std::numeric_limits<int32_t>::min());
+  vs_int->append(std::numeric_limits<int32_t>::max());
+  vs_int->append(0);
+
+  FrameOfReferenceSegment<int32_t> for_segment(vs_int);
+  EXPECT_EQ(for_segment.block_bit_widths(), (std::vector<uint8_t>{32}));
+  EXPECT_EQ(for_segment.get(0), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(for_segment.get(1), std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(for_segment.get(2), 0);
+
+  vs_long->append(std::numeric_limits<int64_t>::min());
+  vs_long->append(std::numeric_limits<int64_t>::max());
+  FrameOfReferenceSegment<int64_t> long_segment(vs_long);
+  EXPECT_EQ(long_segment.block_bit_widths(), (std::vector<uint8_t>{13, 64}));
+  EXPECT_EQ(long_segment.get(2148), std::numeric_limits<int64_t>::min());
+  EXPECT_EQ(long_segment.get(2149), std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(long_segment.get(2147), -1000 - 99 % 7);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, WideBlockRange) {
+  // Nanosecond timestamps: the range of the second block exceeds 2^32, the first block stays narrow
+  auto vs_timestamps = std::make_shared<ValueSegment<int64_t>>();
+  const auto block_size = static_cast<int64_t>(FrameOfReferenceSegment<int64_t>::BLOCK_SIZE);
+  for (auto index = int64_t{0}; index < block_size; ++index) {
+    vs_timestamps->append(int64_t{1'500'000'000'000'000'000} + index);
+  }
+  for (auto index = int64_t{0}; index < 50; ++index) {
+    vs_timestamps->append(int64_t{1'600'000'000'000'000'000} + index * 1'000'000'000'000);
+  }
+
+  FrameOfReferenceSegment<int64_t> for_segment(vs_timestamps);
+  // 2047 needs 11 bits, 49 * 10^12 needs 46 bits
+  EXPECT_EQ(for_segment.block_bit_widths(), (std::vector<uint8_t>{11, 46}));
+
+  const auto& values = vs_timestamps->values();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    EXPECT_EQ(for_segment.get(chunk_offset), values[chunk_offset]);
+  }
+  std::vector<int64_t> decoded;
+  for_segment.decode_block(1, decoded);
+  EXPECT_EQ(decoded, std::vector<int64_t>(values.cbegin() + block_size, values.cend()));
+
+  Table table{3};
+  table.add_column("a", "long");
+  table.append({int64_t{0}});
+  table.append({int64_t{1} << 40});
+  table.append({int64_t{-(int64_t{1} << 40)}});
+  table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  const auto& chunk = table.get_chunk(ChunkID{0});
+  const auto segment = std::dynamic_pointer_cast<FrameOfReferenceSegment<int64_t>>(chunk.get_segment(ColumnID{0}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ(segment->get(1), int64_t{1} << 40);
+  EXPECT_EQ(segment->get(2), -(int64_t{1} << 40));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, EstimateMemoryUsage) {
+  FrameOfReferenceSegment<int64_t> for_segment(vs_long);
+  // two block minima, bit widths, and word indices plus 2048 values with 13 bits (416 words) and 100 values with
+  // 3 bits (5 words)
+  EXPECT_EQ(for_segment.estimate_memory_usage(), 2 * 8u + 2 * 1u + 2 * 8u + 421 * 8u);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressChunk) {
+  Table table{10};
+  table.add_column("a", "long");
+  table.append({int64_t{5}});
+  table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  const auto segment = table.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int64_t>>(segment), nullptr);
+
+  Table string_table{10};
+  string_table.add_column("a", "string");
+  string_table.append({"five"});
+  EXPECT_THROW(string_table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/front_coded_dictionary.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = 0; index < 100; ++index) {
+      values.push_back("https://example.com/page/" + std::to_string(1000 + index * 2));
+    }
+    values.push_back("https://example.org");
+    values.push_back("mailto:someone");
+    std::sort(values.begin(), values.end());
+  }
+
+  std::vector<std::string> values;
+};
+
+TEST_F(StorageFrontCodedDictionaryTest, AccessValues) {
+  FrontCodedDictionary dictionary(values);
+  ASSERT_EQ(dictionary.size(), values.size());
+
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(dictionary[index], values[index]);
+  }
+
+  EXPECT_EQ(dictionary.at(0), values[0]);
+  EXPECT_THROW(dictionary.at(values.size()), std::exception);
+
+  EXPECT_EQ(dictionary.decode(), values);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, LowerUpperBound) {
+  FrontCodedDictionary dictionary(values);
+
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(dictionary.lower_bound(values[index]), index);
+    EXPECT_EQ(dictionary.upper_bound(values[index]), index + 1);
+  }
+
+  // Values that are not part of the dictionary
+  const auto search_values = std::vector<std::string>{"", "a", "https://example.com/page/1001",
+                                                      "https://example.com/page/10", "https://example.net", "zzz"};
+  for (const auto& search_value : search_values) {
+    const auto expected = std::lower_bound(values.cbegin(), values.cend(), search_value) - values.cbegin();
+    EXPECT_EQ(dictionary.lower_bound(search_value), static_cast<size_t>(expected));
+    EXPECT_EQ(dictionary.upper_bound(search_value), static_cast<size_t>(expected));
+  }
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, EmptyAndLongValues) {
+  FrontCodedDictionary empty_dictionary(std::vector<std::string>{});
+  EXPECT_TRUE(empty_dictionary.empty());
+  EXPECT_EQ(empty_dictionary.lower_bound("a"), 0u);
+
+  // The empty string and values longer than 127 characters, whose lengths need more than one byte
+  const auto long_values = std::vector<std::string>{"", std::string(300, 'a'), std::string(300, 'a') + "b"};
+  FrontCodedDictionary dictionary(long_values);
+  EXPECT_EQ(dictionary[0], "");
+  EXPECT_EQ(dictionary[1], long_values[1]);
+  EXPECT_EQ(dictionary[2], long_values[2]);
+  EXPECT_EQ(dictionary.upper_bound(long_values[1]), 2u);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, IsSmallerThanVector) {
+  FrontCodedDictionary dictionary(values);
+
+  auto vector_size = sizeof(std::string) * values.size();
+  for (const auto& value : values) vector_size += value.size();
+
+  EXPECT_LT(dictionary.estimate_memory_usage() * 3, vector_size);
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class StoragePosListTest : public BaseTest {};
+
+TEST_F(StoragePosListTest, TracksSingleChunkAndSortedness) {
+  auto pos_list = PosList{};
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_TRUE(pos_list.is_sorted());
+
+  pos_list.push_back(RowID{ChunkID{2}, 3});
+  pos_list.push_back(RowID{ChunkID{2}, 5});
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.single_chunk_id(), ChunkID{2});
+  EXPECT_TRUE(pos_list.is_sorted());
+
+  pos_list.push_back(RowID{ChunkID{2}, 4});
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_FALSE(pos_list.is_sorted());
+
+  pos_list.push_back(RowID{ChunkID{3}, 0});
+  EXPECT_FALSE(pos_list.references_single_chunk());
+  EXPECT_FALSE(pos_list.is_sorted());
+
+  const auto constructed = PosList{{ChunkID{0}, 1}, {ChunkID{1}, 0}};
+  EXPECT_FALSE(constructed.references_single_chunk());
+  EXPECT_TRUE(constructed.is_sorted());
+}
+
+TEST_F(StoragePosListTest, EntireChunk) {
+  const auto pos_list = PosList::entire_chunk(ChunkID{4}, 3);
+  EXPECT_TRUE(pos_list->is_entire_chunk());
+  EXPECT_TRUE(pos_list->references_single_chunk());
+  EXPECT_EQ(pos_list->single_chunk_id(), ChunkID{4});
+  EXPECT_TRUE(pos_list->is_sorted());
+  EXPECT_EQ(pos_list->size(), 3u);
+  EXPECT_EQ((*pos_list)[2], (RowID{ChunkID{4}, 2}));
+  EXPECT_EQ(pos_list->estimate_memory_usage(), 0u);
+
+  const auto row_ids = std::vector<RowID>(pos_list->begin(), pos_list->end());
+  EXPECT_EQ(row_ids, (std::vector<RowID>{{ChunkID{4}, 0}, {ChunkID{4}, 1}, {ChunkID{4}, 2}}));
+  EXPECT_EQ(*pos_list, (PosList{{ChunkID{4}, 0}, {ChunkID{4}, 1}, {ChunkID{4}, 2}}));
+  EXPECT_NE(*pos_list, (PosList{{ChunkID{4}, 0}, {ChunkID{4}, 1}}));
+}
+
+TEST_F(StoragePosListTest, GroupByChunk) {
+  auto pos_list = PosList{};
+  for (auto index = ChunkOffset{0}; index < 40; ++index) pos_list.push_back(RowID{ChunkID{index % 3 * 2}, index});
+  EXPECT_TRUE(pos_list.benefits_from_grouping(0, 40));
+  EXPECT_FALSE(pos_list.benefits_from_grouping(0, 10));
+
+  const auto groups = pos_list.group_by_chunk(1, 40);
+  EXPECT_EQ(groups.chunk_ids, (std::vector<ChunkID>{ChunkID{0}, ChunkID{2}, ChunkID{4}}));
+  EXPECT_EQ(groups.group_begins, (std::vector<size_t>{0, 13, 26, 39}));
+  ASSERT_EQ(groups.indices.size(), 39u);
+  EXPECT_EQ(groups.indices[0], 3u);
+  EXPECT_EQ(groups.indices[12], 39u);
+  EXPECT_EQ(groups.indices[13], 1u);
+  EXPECT_EQ(groups.indices[26], 2u);
+
+  // runs of consecutive positions in the same chunk are long enough
+  auto clustered_pos_list = PosList{};
+  for (auto index = ChunkOffset{0}; index < 40; ++index) {
+    clustered_pos_list.push_back(RowID{ChunkID{1 - index / 20}, index});
+  }
+  EXPECT_FALSE(clustered_pos_list.benefits_from_grouping(0, 40));
+}
+
+}  // namespace opossum
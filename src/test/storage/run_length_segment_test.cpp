@@ -0,0 +1,72 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    vs_int->append(5);
+    vs_int->append(5);
+    vs_int->append(6);
+    vs_int->append(6);
+    vs_int->append(6);
+    vs_int->append(4);
+    vs_int->append(5);
+
+    vs_str->append("Bill");
+    vs_str->append("Bill");
+    vs_str->append("Steve");
+  }
+
+  std::shared_ptr<ValueSegment<int>> vs_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vs_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegment) {
+  auto segment = make_shared_by_data_type<BaseSegment, RunLengthSegment>("int", vs_int);
+  auto rle_segment = std::dynamic_pointer_cast<RunLengthSegment<int>>(segment);
+
+  EXPECT_EQ(rle_segment->size(), 7u);
+  EXPECT_EQ(rle_segment->values(), (std::vector<int>{5, 6, 4, 5}));
+  EXPECT_EQ(rle_segment->end_positions(), (std::vector<ChunkOffset>{1, 4, 5, 6}));
+}
+
+TEST_F(StorageRunLengthSegmentTest, AccessValues) {
+  RunLengthSegment<int> rle_int(vs_int);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < vs_int->size(); ++chunk_offset) {
+    EXPECT_EQ(rle_int.get(chunk_offset), vs_int->values()[chunk_offset]);
+  }
+
+  RunLengthSegment<std::string> rle_str(vs_str);
+  EXPECT_EQ(rle_str[1], static_cast<AllTypeVariant>("Bill"));
+  EXPECT_EQ(rle_str.get(2), "Steve");
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  RunLengthSegment<int> rle(std::make_shared<ValueSegment<int>>());
+  EXPECT_EQ(rle.size(), 0u);
+  EXPECT_EQ(rle.estimate_memory_usage(), 0u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, ThrowsExceptionOnAppend) {
+  RunLengthSegment<int> rle(vs_int);
+  EXPECT_THROW(rle.append(0), std::exception);
+}
+
+TEST_F(StorageRunLengthSegmentTest, EstimateMemoryUsage) {
+  RunLengthSegment<int> rle(vs_int);
+  // four runs with one int value and one end position each
+  EXPECT_EQ(rle.estimate_memory_usage(), 32u);
+}
+
+}  // namespace opossum
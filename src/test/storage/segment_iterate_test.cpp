@@ -0,0 +1,147 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : int_values) vs_int->append(value);
+    for (const auto& value : string_values) vs_str->append(value);
+  }
+
+  // collects the values and offsets that segment_for_each passes on
+  template <typename T>
+  std::vector<std::pair<T, ChunkOffset>> for_each_values(const BaseSegment& segment) {
+    auto result = std::vector<std::pair<T, ChunkOffset>>{};
+    segment_for_each<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+      result.emplace_back(value, chunk_offset);
+    });
+    return result;
+  }
+
+  // collects the values and offsets that the iterators of segment_with_iterators yield
+  template <typename T>
+  std::vector<std::pair<T, ChunkOffset>> iterator_values(const BaseSegment& segment) {
+    auto result = std::vector<std::pair<T, ChunkOffset>>{};
+    segment_with_iterators<T>(segment, [&](auto begin, const auto end) {
+      for (; begin != end; ++begin) {
+        const auto position = *begin;
+        result.emplace_back(position.value, position.chunk_offset);
+      }
+    });
+    return result;
+  }
+
+  template <typename T>
+  static std::vector<std::pair<T, ChunkOffset>> with_offsets(const std::vector<T>& values) {
+    auto result = std::vector<std::pair<T, ChunkOffset>>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      result.emplace_back(values[chunk_offset], chunk_offset);
+    }
+    return result;
+  }
+
+  const std::vector<int> int_values{4, 4, 7, -3, 7, 7, 12, 4};
+  const std::vector<std::string> string_values{"Steve", "Bill", "Bill", "Alexander", "Steve", "Hasso"};
+
+  std::shared_ptr<ValueSegment<int>> vs_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vs_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageSegmentIterateTest, ValueSegment) {
+  EXPECT_EQ(for_each_values<int>(*vs_int), with_offsets(int_values));
+  EXPECT_EQ(iterator_values<int>(*vs_int), with_offsets(int_values));
+}
+
+TEST_F(StorageSegmentIterateTest, DictionarySegment) {
+  const auto dictionary_int = DictionarySegment<int>(vs_int);
+  EXPECT_EQ(for_each_values<int>(dictionary_int), with_offsets(int_values));
+  EXPECT_EQ(iterator_values<int>(dictionary_int), with_offsets(int_values));
+
+  const auto dictionary_string = DictionarySegment<std::string>(vs_str);
+  EXPECT_EQ(for_each_values<std::string>(dictionary_string), with_offsets(string_values));
+  EXPECT_EQ(iterator_values<std::string>(dictionary_string), with_offsets(string_values));
+}
+
+TEST_F(StorageSegmentIterateTest, RunLengthSegment) {
+  const auto run_length_int = RunLengthSegment<int>(vs_int);
+  EXPECT_EQ(for_each_values<int>(run_length_int), with_offsets(int_values));
+  EXPECT_EQ(iterator_values<int>(run_length_int), with_offsets(int_values));
+}
+
+TEST_F(StorageSegmentIterateTest, FrameOfReferenceSegment) {
+  // span multiple blocks
+  auto values = std::vector<int>{};
+  for (auto index = 0; index < 5000; ++index) {
+    values.push_back(index % 7 * 1000 - index);
+    vs_int->append(values.back());
+  }
+  values.insert(values.begin(), int_values.cbegin(), int_values.cend());
+
+  const auto frame_of_reference_int = FrameOfReferenceSegment<int>(vs_int);
+  EXPECT_EQ(for_each_values<int>(frame_of_reference_int), with_offsets(values));
+  EXPECT_EQ(iterator_values<int>(frame_of_reference_int), with_offsets(values));
+}
+
+TEST_F(StorageSegmentIterateTest, ReferenceSegment) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto index = size_t{0}; index < string_values.size(); ++index) {
+    table->append({int_values[index], string_values[index]});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  // references a run-length and a value segment, out of order
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{
+      {ChunkID{1}, 2}, {ChunkID{0}, 0}, {ChunkID{0}, 2}, {ChunkID{1}, 0}, {ChunkID{0}, 2}});
+  const auto reference_int = ReferenceSegment(table, ColumnID{0}, pos_list);
+  const auto reference_string = ReferenceSegment(table, ColumnID{1}, pos_list);
+
+  const auto expected_int = with_offsets(std::vector<int>{7, 4, 7, -3, 7});
+  EXPECT_EQ(for_each_values<int>(reference_int), expected_int);
+  EXPECT_EQ(iterator_values<int>(reference_int), expected_int);
+
+  const auto expected_string = with_offsets(std::vector<std::string>{"Hasso", "Steve", "Bill", "Alexander", "Bill"});
+  EXPECT_EQ(for_each_values<std::string>(reference_string), expected_string);
+  EXPECT_EQ(iterator_values<std::string>(reference_string), expected_string);
+}
+
+TEST_F(StorageSegmentIterateTest, ReferenceSegmentWithInterleavedChunks) {
+  const auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 30; ++value) table->append({value});
+  table->compress_chunk(ChunkID{1});
+
+  // positions alternate between the chunks, so they are grouped by chunk
+  auto pos_list = std::make_shared<PosList>();
+  auto expected = std::vector<int>{};
+  for (auto index = ChunkOffset{0}; index < 30; ++index) {
+    pos_list->push_back(RowID{ChunkID{index % 3}, index / 3});
+    expected.push_back(static_cast<int>(index % 3 * 10 + index / 3));
+  }
+  ASSERT_TRUE(pos_list->benefits_from_grouping(0, pos_list->size()));
+
+  const auto reference_segment = ReferenceSegment(table, ColumnID{0}, pos_list);
+  EXPECT_EQ(for_each_values<int>(reference_segment), with_offsets(expected));
+}
+
+TEST_F(StorageSegmentIterateTest, WrongDataType) {
+  EXPECT_THROW(for_each_values<float>(*vs_int), std::logic_error);
+}
+
+}  // namespace opossum
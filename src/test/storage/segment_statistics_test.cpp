@@ -0,0 +1,101 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto value : {7, 3, 12, 7, 5, 3}) vs_int->append(value);
+    for (const auto& value : {"Steve", "Bill", "Hasso", "Bill"}) vs_str->append(value);
+  }
+
+  std::shared_ptr<ValueSegment<int>> vs_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vs_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageSegmentStatisticsTest, BuildForAllSegmentTypes) {
+  const auto segments = std::vector<std::shared_ptr<BaseSegment>>{
+      vs_int, std::make_shared<DictionarySegment<int>>(vs_int), std::make_shared<RunLengthSegment<int>>(vs_int),
+      std::make_shared<FrameOfReferenceSegment<int>>(vs_int)};
+
+  for (const auto& segment : segments) {
+    const auto statistics = SegmentStatistics<int>::build(*segment);
+    ASSERT_NE(statistics, nullptr);
+    EXPECT_EQ(statistics->min(), 3);
+    EXPECT_EQ(statistics->max(), 12);
+    EXPECT_EQ(statistics->distinct_count(), 4u);
+    EXPECT_EQ(statistics->null_count(), 0u);
+  }
+
+  const auto string_statistics = SegmentStatistics<std::string>::build(DictionarySegment<std::string>(vs_str));
+  EXPECT_EQ(string_statistics->min(), "Bill");
+  EXPECT_EQ(string_statistics->max(), "Steve");
+  EXPECT_EQ(string_statistics->distinct_count(), 3u);
+
+  EXPECT_EQ(SegmentStatistics<int>::build(ValueSegment<int>()), nullptr);
+}
+
+TEST_F(StorageSegmentStatisticsTest, CanPrune) {
+  const auto statistics = SegmentStatistics<int>(3, 12, 4);
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 2));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 3));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 12));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 13));
+
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpNotEquals, 3));
+  EXPECT_TRUE(SegmentStatistics<int>(5, 5, 1).can_prune(ScanType::OpNotEquals, 5));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThan, 3));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThan, 4));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThanEquals, 2));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThanEquals, 3));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThan, 12));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThan, 11));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThanEquals, 13));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThanEquals, 12));
+
+  // the search value is cast to the segment's type
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThan, "12"));
+}
+
+TEST_F(StorageSegmentStatisticsTest, ComputedForSealedChunks) {
+  for (const auto background_compression : {std::optional<EncodingType>{EncodingType::Dictionary},
+                                            std::optional<EncodingType>{}}) {
+    auto table = Table{2};
+    table.add_column("a", "int");
+    table.set_background_compression(background_compression);
+    table.append({4});
+    table.append({2});
+    table.append({9});
+    table.wait_for_background_compression();
+
+    const auto statistics = std::dynamic_pointer_cast<const SegmentStatistics<int>>(
+        table.get_chunk(ChunkID{0}).get_segment_statistics(ColumnID{0}));
+    ASSERT_NE(statistics, nullptr);
+    EXPECT_EQ(statistics->min(), 2);
+    EXPECT_EQ(statistics->max(), 4);
+
+    // the last chunk is still open
+    EXPECT_EQ(table.get_chunk(ChunkID{1}).get_segment_statistics(ColumnID{0}), nullptr);
+
+    table.compress_chunk(ChunkID{1});
+    EXPECT_NE(table.get_chunk(ChunkID{1}).get_segment_statistics(ColumnID{0}), nullptr);
+  }
+}
+
+}  // namespace opossum
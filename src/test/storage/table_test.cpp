@@ -10,6 +10,9 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/table.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -83,4 +86,91 @@ TEST_F(StorageTableTest, CompressChunkReplacesWithDictionarySegment) {
   EXPECT_NE(dictionary_segment_ptr, nullptr);
 }
 
+TEST_F(StorageTableTest, CompressChunkWithRunLengthEncoding) {
+  t.append({4, "Hello,"});
+  t.append({4, "Hello,"});
+
+  t.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+  auto& chunk = t.get_chunk(ChunkID{0});
+  auto run_length_segment_ptr = std::dynamic_pointer_cast<RunLengthSegment<int>>(chunk.get_segment(ColumnID{0}));
+  ASSERT_NE(run_length_segment_ptr, nullptr);
+  EXPECT_EQ(run_length_segment_ptr->values().size(), 1u);
+  EXPECT_EQ(run_length_segment_ptr->size(), 2u);
+}
+
+TEST_F(StorageTableTest, CompressChunkReencodesEncodedSegments) {
+  t.append({4, "Hello,"});
+  t.append({4, "Hello,"});
+
+  t.compress_chunk(ChunkID{0});
+  t.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+  const auto& chunk = t.get_chunk(ChunkID{0});
+  const auto segment = std::dynamic_pointer_cast<RunLengthSegment<std::string>>(chunk.get_segment(ColumnID{1}));
+  ASSERT_NE(segment, nullptr);
+  EXPECT_EQ((*segment)[0], AllTypeVariant{"Hello,"});
+}
+
+TEST_F(StorageTableTest, BackgroundCompressionOfSealedChunks) {
+  EXPECT_EQ(t.background_compression(), EncodingType::Dictionary);
+
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.wait_for_background_compression();
+
+  // The first chunk was sealed when the third row was appended, the second one is still open
+  const auto& sealed_chunk = t.get_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int>>(sealed_chunk.get_segment(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(sealed_chunk.get_segment(ColumnID{1})), nullptr);
+  EXPECT_EQ((*sealed_chunk.get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+
+  const auto& open_chunk = t.get_chunk(ChunkID{1});
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<int>>(open_chunk.get_segment(ColumnID{0})), nullptr);
+  EXPECT_EQ(t.row_count(), 3u);
+}
+
+TEST_F(StorageTableTest, BackgroundCompressionWithChosenEncoding) {
+  t.set_background_compression(EncodingType::RunLength);
+  for (auto row = 0; row < 5; ++row) t.append({4, "Hello,"});
+  t.wait_for_background_compression();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto segment = t.get_chunk(chunk_id).get_segment(ColumnID{0});
+    EXPECT_NE(std::dynamic_pointer_cast<RunLengthSegment<int>>(segment), nullptr);
+  }
+
+  EXPECT_THROW(t.set_background_compression(EncodingType::FrameOfReference), std::logic_error);
+}
+
+TEST_F(StorageTableTest, BackgroundCompressionRejectsUnsupportedColumns) {
+  // Sealed chunks are compressed by background jobs, so a column that cannot be encoded has to be rejected upfront
+  Table int_table{2};
+  int_table.add_column("a", "int");
+  int_table.set_background_compression(EncodingType::FrameOfReference);
+  EXPECT_THROW(int_table.add_column("b", "string"), std::logic_error);
+  EXPECT_THROW(int_table.add_column_definition("b", "float"), std::logic_error);
+  EXPECT_EQ(int_table.column_count(), 1u);
+
+  int_table.add_column("c", "long");
+  for (auto row = 0; row < 5; ++row) int_table.append({row, int64_t{row}});
+  int_table.wait_for_background_compression();
+
+  const auto& sealed_chunk = int_table.get_chunk(ChunkID{1});
+  EXPECT_NE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int>>(sealed_chunk.get_segment(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int64_t>>(sealed_chunk.get_segment(ColumnID{1})),
+            nullptr);
+  EXPECT_EQ((*sealed_chunk.get_segment(ColumnID{1}))[1], AllTypeVariant{int64_t{3}});
+}
+
+TEST_F(StorageTableTest, DisabledBackgroundCompression) {
+  t.set_background_compression(std::nullopt);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+  t.wait_for_background_compression();
+
+  const auto segment = t.get_chunk(ChunkID{0}).get_segment(ColumnID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<int>>(segment), nullptr);
+}
+
 }  // namespace opossum
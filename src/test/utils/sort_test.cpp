@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/parallel_sort.hpp"
+#include "utils/radix_sort.hpp"
+
+namespace opossum {
+
+class UtilsSortTest : public BaseTest {};
+
+TEST_F(UtilsSortTest, RadixSortSignedKeys) {
+  auto generator = std::mt19937{17};
+  auto distribution = std::uniform_int_distribution<int64_t>{std::numeric_limits<int64_t>::min(),
+                                                             std::numeric_limits<int64_t>::max()};
+
+  auto data = std::vector<std::pair<int64_t, uint32_t>>{};
+  for (auto index = uint32_t{0}; index < 1000; ++index) data.emplace_back(distribution(generator), index);
+  data.emplace_back(0, 1000);
+  data.emplace_back(-1, 1001);
+
+  auto expected = data;
+  std::stable_sort(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.first < rhs.first;
+  });
+
+  radix_sort(data);
+  EXPECT_EQ(data, expected);
+}
+
+TEST_F(UtilsSortTest, RadixSortIsStable) {
+  auto data = std::vector<std::pair<int32_t, int32_t>>{{3, 0}, {-2, 1}, {3, 2}, {-2, 3}, {0, 4}};
+  radix_sort(data);
+  EXPECT_EQ(data, (std::vector<std::pair<int32_t, int32_t>>{{-2, 1}, {-2, 3}, {0, 4}, {3, 0}, {3, 2}}));
+}
+
+TEST_F(UtilsSortTest, ParallelSort) {
+  auto generator = std::mt19937{23};
+  auto data = std::vector<int32_t>(10'000);
+  for (auto& value : data) value = static_cast<int32_t>(generator());
+
+  auto expected = data;
+  std::sort(expected.begin(), expected.end());
+
+  parallel_sort(data, [](auto& partition) { std::sort(partition.begin(), partition.end()); }, std::less<>{}, 100);
+  EXPECT_EQ(data, expected);
+}
+
+}  // namespace opossum